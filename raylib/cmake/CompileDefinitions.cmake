@@ -54,6 +54,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_TTF)
     define_if("raylib" SUPPORT_TEXT_MANIPULATION)
     define_if("raylib" SUPPORT_MESH_GENERATION)
+    define_if("raylib" SUPPORT_MODELS_THREADS)
     define_if("raylib" SUPPORT_FILEFORMAT_OBJ)
     define_if("raylib" SUPPORT_FILEFORMAT_MTL)
     define_if("raylib" SUPPORT_FILEFORMAT_IQM)
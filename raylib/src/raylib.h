@@ -330,6 +330,10 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rmodels module
+typedef struct MeshBVH MeshBVH;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -349,10 +353,16 @@ typedef struct Mesh {
     float *animNormals;     // Animated normals (after bones transformations)
     unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    Matrix *boneMatrices;   // Bones skinning matrices, bind pose to animated pose (set by UpdateModelAnimation())
+    int boneCount;          // Number of bones skinning matrices
+    int skinningMode;       // Skinning mode of last UpdateModelAnimation() (ModelSkinningMode), GPU mode keeps bind pose in vertex buffers
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
+
+    // Ray collision data
+    MeshBVH *bvh;           // Bounding volume hierarchy for ray collisions (GenMeshBVH())
 } Mesh;
 
 // Shader
@@ -520,6 +530,20 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Profiler frame, times in seconds
+typedef struct ProfilerFrame {
+    double start;                   // Frame start time, end of previous EndDrawing() (seconds since InitWindow())
+    double updateTime;              // Time until BeginDrawing() (update logic and drawing to render textures)
+    double drawTime;                // Time from BeginDrawing() to buffers swap
+    double batchTime;               // Time spent drawing render batches (part of update and draw times)
+    double swapTime;                // Time swapping buffers, waiting for target FPS and polling input events
+    double gpuTime;                 // GPU time drawing render batches, negative if not available (yet)
+    int drawCalls;                  // Draw calls issued
+    int vertices;                   // Vertex drawn
+    int textureBinds;               // Textures bound for drawing
+    int bufferBytes;                // Vertex data bytes uploaded to GPU
+} ProfilerFrame;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -786,7 +810,10 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: bone ids
+    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: bone weights
+    SHADER_LOC_BONE_MATRICES        // Shader location: matrix array uniform: bones skinning matrices
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -891,6 +918,21 @@ typedef enum {
     BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
 } BlendMode;
 
+// Shapes render modes
+// NOTE: SDF mode applies to circles, rings, rounded rectangles and thick lines, other shapes are always tessellated
+typedef enum {
+    SHAPES_RENDER_TESSELLATED = 0,  // Shapes are tessellated into lines, triangles and quads (default)
+    SHAPES_RENDER_SDF               // Shapes are drawn as one quad each, anti-aliased with signed distance functions (OpenGL 3.3+ and ES3, solid color only)
+} ShapesRenderMode;
+
+// Model skinning modes
+// NOTE: GPU mode applies to meshes drawn with the default shader or with custom shaders providing the
+// boneMatrices uniform (and vertexBoneIds/vertexBoneWeights attributes), other meshes are skinned on CPU
+typedef enum {
+    MODEL_SKINNING_CPU = 0,         // Animated vertices are computed on CPU and uploaded every pose change (default)
+    MODEL_SKINNING_GPU              // Animated vertices are computed in the vertex shader, only bone matrices are sent (OpenGL 3.3+ and ES3)
+} ModelSkinningMode;
+
 // Gesture
 // NOTE: Provided as bit-wise flags to enable only desired gestures
 typedef enum {
@@ -1142,6 +1184,18 @@ RLAPI void StartAutomationEventRecording(void);
 RLAPI void StopAutomationEventRecording(void);                                          // Stop recording automation events
 RLAPI void PlayAutomationEvent(AutomationEvent event);                                  // Play a recorded automation event
 
+// Profiler functionality
+// NOTE: Profiler must be used from the main thread, frames are measured by EndDrawing()
+RLAPI void EnableProfiler(void);                                                        // Enable profiler (frames history is cleared)
+RLAPI void DisableProfiler(void);                                                       // Disable profiler (frames history is kept)
+RLAPI bool IsProfilerEnabled(void);                                                     // Check if profiler is enabled
+RLAPI void BeginProfileScope(const char *name);                                         // Begin a named profile scope (scopes can be nested)
+RLAPI void EndProfileScope(void);                                                       // End last profile scope
+RLAPI ProfilerFrame GetProfilerFrame(int index);                                        // Get profiler frame from history, index 0 is the last frame measured
+RLAPI int GetProfilerFrameCount(void);                                                  // Get number of frames in profiler history, up to MAX_PROFILER_FRAMES
+RLAPI void DrawProfilerOverlay(int posX, int posY);                                     // Draw profiler overlay: last frame times, render counters, frame times graph and top scopes
+RLAPI bool ExportProfilerTrace(const char *fileName);                                   // Export profiler history as Chrome trace JSON file (chrome://tracing, Perfetto)
+
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
 //------------------------------------------------------------------------------------
@@ -1216,6 +1270,8 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI void SetShapesRenderMode(int mode);                               // Set shapes render mode (ShapesRenderMode)
+RLAPI int GetShapesRenderMode(void);                                    // Get shapes render mode (ShapesRenderMode)
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1533,6 +1589,7 @@ RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transfo
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshBVH(Mesh *mesh);                                                          // Compute mesh bounding volume hierarchy for ray collisions (again after changing vertices)
 
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
@@ -1558,6 +1615,8 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void SetModelSkinningMode(int mode);                                                  // Set model skinning mode (ModelSkinningMode), applied on next animation update
+RLAPI int GetModelSkinningMode(void);                                                       // Get model skinning mode (ModelSkinningMode)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -1569,6 +1628,7 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI void GetRayCollisionMeshBatch(const Ray *rays, int count, Mesh mesh, Matrix transform, RayCollision *collisions); // Get collision info between many rays and mesh
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
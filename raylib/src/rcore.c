@@ -55,6 +55,10 @@
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
 *
+*       #define SUPPORT_PROFILER
+*           Support frame profiler: frame times history measured by EndDrawing(), named CPU scopes, render batches
+*           timing on CPU and GPU, render counters, profiler overlay and Chrome trace JSON export
+*
 *   DEPENDENCIES:
 *       raymath  - 3D math functionality (Vector2, Vector3, Matrix, Quaternion)
 *       camera   - Multiple 3D camera modes (free, orbital, 1st person, 3rd person)
@@ -229,6 +233,19 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_PROFILER_FRAMES
+    #define MAX_PROFILER_FRAMES          256        // Maximum number of frames kept in profiler history
+#endif
+#ifndef MAX_PROFILER_EVENTS
+    #define MAX_PROFILER_EVENTS         8192        // Maximum number of profile scopes kept in profiler history
+#endif
+#ifndef MAX_PROFILER_SCOPE_NAMES
+    #define MAX_PROFILER_SCOPE_NAMES     128        // Maximum number of different profile scope names
+#endif
+#ifndef MAX_PROFILER_SCOPE_DEPTH
+    #define MAX_PROFILER_SCOPE_DEPTH      32        // Maximum profile scopes nesting depth
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -445,6 +462,48 @@ static AutomationEventList *currentEventList = NULL;        // Current automatio
 static bool automationEventRecording = false;               // Recording automation events flag
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
 #endif
+
+#if defined(SUPPORT_PROFILER)
+#define MAX_PROFILER_SCOPE_NAME_LENGTH    32        // Maximum length of profile scope names (longer names are truncated)
+
+// Profiler event, a finished profile scope
+typedef struct ProfilerEvent {
+    int name;                           // Scope name index (profiler.names)
+    int depth;                          // Scope nesting depth, 0 for outer scopes
+    double start;                       // Scope start time (seconds since InitTimer())
+    double duration;                    // Scope duration (seconds)
+} ProfilerEvent;
+
+// Profiler data
+typedef struct ProfilerData {
+    bool enabled;                       // Profiler enabled, frames and scopes are being measured
+
+    ProfilerFrame frames[MAX_PROFILER_FRAMES];      // Frames history (ring buffer)
+    unsigned int statsFrames[MAX_PROFILER_FRAMES];  // rlgl stats frame of every frame, GPU timer results are tagged with it
+    int gpuPending[MAX_PROFILER_FRAMES];            // GPU timer results still pending for every frame
+    double gpuTimes[MAX_PROFILER_FRAMES];           // GPU time received so far for every frame
+    int frameHead;                      // Next frame position in history
+    int frameCount;                     // Frames in history
+
+    ProfilerEvent events[MAX_PROFILER_EVENTS];      // Profile scopes history (ring buffer), in scope end order
+    int eventHead;                      // Next event position in history
+    int eventCount;                     // Events in history
+
+    char names[MAX_PROFILER_SCOPE_NAMES][MAX_PROFILER_SCOPE_NAME_LENGTH];  // Profile scope names
+    int nameCount;                      // Profile scope names count
+
+    int scopeNames[MAX_PROFILER_SCOPE_DEPTH];       // Open scopes stack: name index (-1 if names table is full)
+    double scopeStarts[MAX_PROFILER_SCOPE_DEPTH];   // Open scopes stack: start time
+    int scopeDepth;                     // Open scopes count (can exceed MAX_PROFILER_SCOPE_DEPTH, deeper scopes are not measured)
+
+    double frameStart;                  // Current frame start time
+    double drawStart;                   // Current frame BeginDrawing() time
+    double swapStart;                   // Current frame buffers swap time
+    double batchTime;                   // Current frame time spent drawing render batches
+} ProfilerData;
+
+static ProfilerData profiler = { 0 };                       // Profiler data
+#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -471,6 +530,12 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_PROFILER)
+static int GetProfileScopeName(const char *name);           // Get profile scope name index, name is added if not found
+static void ProfileRenderBatch(bool begin);                 // Measure render batches draws (rlgl render batch callback)
+static void EndProfilerFrame(void);                         // End profiler frame, at the end of EndDrawing()
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -822,6 +887,10 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+#if defined(SUPPORT_PROFILER)
+    if (profiler.enabled) profiler.drawStart = CORE.Time.current;
+#endif
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
@@ -869,6 +938,10 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    if (profiler.enabled) profiler.swapStart = GetTime();
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -932,6 +1005,10 @@ void EndDrawing(void)
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+#if defined(SUPPORT_PROFILER)
+    if (profiler.enabled) EndProfilerFrame();
+#endif
+
     CORE.Time.frameCounter++;
 }
 
@@ -1275,6 +1352,8 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
         shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
         shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+        shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
 
         // Get handles to GLSL uniform locations (vertex shader)
         shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
@@ -1282,6 +1361,7 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
         shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
         shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+        shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
 
         // Get handles to GLSL uniform locations (fragment shader)
         shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
@@ -1310,6 +1390,8 @@ bool IsShaderReady(Shader shader)
     // shader.locs[SHADER_LOC_VERTEX_NORMAL]
     // shader.locs[SHADER_LOC_VERTEX_TANGENT]
     // shader.locs[SHADER_LOC_VERTEX_COLOR]         // Set by default internal shader
+    // shader.locs[SHADER_LOC_VERTEX_BONEIDS]       // Set by default skinning shader
+    // shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]   // Set by default skinning shader
 
     // Vertex shader uniform locations (default)
     // shader.locs[SHADER_LOC_MATRIX_MVP]           // Set by default internal shader
@@ -1317,6 +1399,7 @@ bool IsShaderReady(Shader shader)
     // shader.locs[SHADER_LOC_MATRIX_PROJECTION]
     // shader.locs[SHADER_LOC_MATRIX_MODEL]
     // shader.locs[SHADER_LOC_MATRIX_NORMAL]
+    // shader.locs[SHADER_LOC_BONE_MATRICES]        // Set by default skinning shader
 
     // Fragment shader uniform locations (default)
     // shader.locs[SHADER_LOC_COLOR_DIFFUSE]        // Set by default internal shader
@@ -2644,6 +2727,294 @@ void PlayAutomationEvent(AutomationEvent event)
 #endif
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Profiler
+//----------------------------------------------------------------------------------
+
+// Enable profiler
+// NOTE: Frames are measured from the end of one EndDrawing() to the end of the next one,
+// render batches draws are timed on CPU and GPU (if GPU timer queries are supported)
+void EnableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    profiler.enabled = true;
+    profiler.frameHead = 0;
+    profiler.frameCount = 0;
+    profiler.eventHead = 0;
+    profiler.eventCount = 0;
+    profiler.scopeDepth = 0;
+    profiler.frameStart = GetTime();
+    profiler.drawStart = profiler.frameStart;
+    profiler.swapStart = profiler.frameStart;
+    profiler.batchTime = 0.0;
+
+    rlResetRenderStats();
+    rlSetRenderBatchCallback(ProfileRenderBatch);
+    rlEnableGpuTimer();
+
+    TRACELOG(LOG_INFO, "PROFILER: Profiler enabled");
+#endif
+}
+
+// Disable profiler
+void DisableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    profiler.enabled = false;
+    profiler.scopeDepth = 0;
+
+    rlSetRenderBatchCallback(NULL);
+    rlDisableGpuTimer();
+
+    TRACELOG(LOG_INFO, "PROFILER: Profiler disabled");
+#endif
+}
+
+// Check if profiler is enabled
+bool IsProfilerEnabled(void)
+{
+#if defined(SUPPORT_PROFILER)
+    return profiler.enabled;
+#else
+    return false;
+#endif
+}
+
+// Begin a named profile scope
+// NOTE: Scopes with the same name are grouped by name content, not by pointer
+void BeginProfileScope(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled) return;
+
+    if (profiler.scopeDepth < MAX_PROFILER_SCOPE_DEPTH)
+    {
+        profiler.scopeNames[profiler.scopeDepth] = GetProfileScopeName(name);
+        profiler.scopeStarts[profiler.scopeDepth] = GetTime();
+    }
+
+    profiler.scopeDepth++;
+#endif
+}
+
+// End last profile scope
+void EndProfileScope(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profiler.enabled || (profiler.scopeDepth == 0)) return;
+
+    profiler.scopeDepth--;
+
+    if ((profiler.scopeDepth < MAX_PROFILER_SCOPE_DEPTH) && (profiler.scopeNames[profiler.scopeDepth] >= 0))
+    {
+        ProfilerEvent *event = &profiler.events[profiler.eventHead];
+        event->name = profiler.scopeNames[profiler.scopeDepth];
+        event->depth = profiler.scopeDepth;
+        event->start = profiler.scopeStarts[profiler.scopeDepth];
+        event->duration = GetTime() - event->start;
+
+        profiler.eventHead = (profiler.eventHead + 1)%MAX_PROFILER_EVENTS;
+        if (profiler.eventCount < MAX_PROFILER_EVENTS) profiler.eventCount++;
+    }
+#endif
+}
+
+// Get profiler frame from history, index 0 is the last frame measured
+ProfilerFrame GetProfilerFrame(int index)
+{
+    ProfilerFrame frame = { 0 };
+
+#if defined(SUPPORT_PROFILER)
+    if ((index >= 0) && (index < profiler.frameCount))
+    {
+        frame = profiler.frames[(profiler.frameHead - 1 - index + MAX_PROFILER_FRAMES)%MAX_PROFILER_FRAMES];
+    }
+#endif
+
+    return frame;
+}
+
+// Get number of frames in profiler history
+int GetProfilerFrameCount(void)
+{
+#if defined(SUPPORT_PROFILER)
+    return profiler.frameCount;
+#else
+    return 0;
+#endif
+}
+
+// Draw profiler overlay
+// NOTE: Overlay is drawn into the current frame, its own draw calls and vertex are measured
+void DrawProfilerOverlay(int posX, int posY)
+{
+#if defined(SUPPORT_PROFILER) && defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
+    #define PROFILER_GRAPH_FRAMES       120     // Frames shown on frame times graph
+    #define PROFILER_GRAPH_HEIGHT        40     // Frame times graph height, for 1/30 seconds
+    #define PROFILER_TOP_SCOPES           5     // Scopes shown, by total time on last frame
+
+    if (profiler.frameCount == 0) return;
+
+    ProfilerFrame frame = GetProfilerFrame(0);
+    double frameTime = frame.updateTime + frame.drawTime + frame.swapTime;
+
+    // GPU time is available some frames later
+    double gpuTime = -1.0;
+    for (int i = 0; (i < profiler.frameCount) && (i < 8) && (gpuTime < 0.0); i++) gpuTime = GetProfilerFrame(i).gpuTime;
+
+    // Accumulate last frame scopes by name
+    // NOTE: Events are stored in end order, the search stops on the first event ended before the frame
+    double scopeTimes[MAX_PROFILER_SCOPE_NAMES] = { 0 };
+    int scopeCounts[MAX_PROFILER_SCOPE_NAMES] = { 0 };
+
+    for (int i = 0; i < profiler.eventCount; i++)
+    {
+        ProfilerEvent *event = &profiler.events[(profiler.eventHead - 1 - i + MAX_PROFILER_EVENTS)%MAX_PROFILER_EVENTS];
+        double end = event->start + event->duration;
+
+        if (end < frame.start) break;
+        if ((event->start >= frame.start) && (end <= (frame.start + frameTime)))
+        {
+            scopeTimes[event->name] += event->duration;
+            scopeCounts[event->name]++;
+        }
+    }
+
+    int topScopes[PROFILER_TOP_SCOPES] = { 0 };
+    int topCount = 0;
+
+    for (int i = 0; i < profiler.nameCount; i++)
+    {
+        if (scopeCounts[i] == 0) continue;
+
+        // Insert sorted by time, keeping the top scopes only
+        int k = (topCount < PROFILER_TOP_SCOPES)? topCount++ : PROFILER_TOP_SCOPES;
+        while ((k > 0) && (scopeTimes[topScopes[k - 1]] < scopeTimes[i]))
+        {
+            if (k < PROFILER_TOP_SCOPES) topScopes[k] = topScopes[k - 1];
+            k--;
+        }
+        if (k < PROFILER_TOP_SCOPES) topScopes[k] = i;
+    }
+
+    int width = PROFILER_GRAPH_FRAMES*2 + 10;
+    int height = 5*12 + PROFILER_GRAPH_HEIGHT + topCount*12 + 20;
+
+    DrawRectangle(posX, posY, width, height, (Color){ 0, 0, 0, 200 });     // WARNING: Module required: rshapes
+
+    int y = posY + 5;
+    DrawText(TextFormat("FRAME %.2f ms (%i FPS)", frameTime*1000.0, (frameTime > 0.0)? (int)(1.0/frameTime + 0.5) : 0), posX + 5, y, 10, RAYWHITE); y += 12;
+    DrawText(TextFormat("UPDATE %.2f  DRAW %.2f  SWAP %.2f", frame.updateTime*1000.0, frame.drawTime*1000.0, frame.swapTime*1000.0), posX + 5, y, 10, LIGHTGRAY); y += 12;
+    if (gpuTime >= 0.0) DrawText(TextFormat("BATCHES %.2f ms  GPU %.2f ms", frame.batchTime*1000.0, gpuTime*1000.0), posX + 5, y, 10, ORANGE);
+    else DrawText(TextFormat("BATCHES %.2f ms  GPU n/a", frame.batchTime*1000.0), posX + 5, y, 10, ORANGE);
+    y += 12;
+    DrawText(TextFormat("%i DRAW CALLS  %i TEXTURE BINDS", frame.drawCalls, frame.textureBinds), posX + 5, y, 10, LIGHTGRAY); y += 12;
+    DrawText(TextFormat("%i VERTEX  %.1f KB UPLOADED", frame.vertices, (float)frame.bufferBytes/1024.0f), posX + 5, y, 10, LIGHTGRAY); y += 14;
+
+    // Frame times graph, stacked per frame: update, draw (render batches excluded), render batches, swap
+    int graphBottom = y + PROFILER_GRAPH_HEIGHT;
+    float scale = PROFILER_GRAPH_HEIGHT*30.0f;      // Pixels per second
+
+    DrawRectangle(posX + 5, y, PROFILER_GRAPH_FRAMES*2, PROFILER_GRAPH_HEIGHT, (Color){ 40, 40, 40, 200 });
+    DrawRectangle(posX + 5, graphBottom - (int)(scale/60.0f), PROFILER_GRAPH_FRAMES*2, 1, DARKGRAY);     // 60 FPS mark
+
+    for (int i = 0; (i < profiler.frameCount) && (i < PROFILER_GRAPH_FRAMES); i++)
+    {
+        ProfilerFrame graphFrame = GetProfilerFrame(i);
+        double batchTime = (graphFrame.batchTime < (graphFrame.updateTime + graphFrame.drawTime))? graphFrame.batchTime : (graphFrame.updateTime + graphFrame.drawTime);
+        double sections[4] = { graphFrame.updateTime, graphFrame.drawTime - batchTime, batchTime, graphFrame.swapTime };
+        Color colors[4] = { SKYBLUE, LIME, ORANGE, GRAY };
+
+        // Update time can include render batches draws (render textures), they are shown after draw time
+        if (sections[1] < 0.0) { sections[0] += sections[1]; sections[1] = 0.0; }
+
+        int x = posX + 5 + (PROFILER_GRAPH_FRAMES - 1 - i)*2;
+        int top = graphBottom;
+
+        for (int s = 0; (s < 4) && (top > y); s++)
+        {
+            int barHeight = (int)(sections[s]*scale + 0.5);
+            if ((top - barHeight) < y) barHeight = top - y;
+            if (barHeight > 0) DrawRectangle(x, top - barHeight, 2, barHeight, colors[s]);
+            top -= barHeight;
+        }
+    }
+
+    y = graphBottom + 5;
+
+    for (int i = 0; i < topCount; i++)
+    {
+        DrawText(TextFormat("%s: %.3f ms (%i)", profiler.names[topScopes[i]], scopeTimes[topScopes[i]]*1000.0, scopeCounts[topScopes[i]]), posX + 5, y, 10, RAYWHITE);
+        y += 12;
+    }
+#endif
+}
+
+// Export profiler history as Chrome trace JSON file
+// NOTE: Frames are exported with their update/draw/swap sections, profile scopes as nested events,
+// render counters as counter events and GPU render batches time on a separate track
+bool ExportProfilerTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    #define PROFILER_TRACE_LINE_LENGTH      256     // Maximum length of an exported trace event
+
+    // NOTE: Trace events use microseconds
+    char *json = (char *)RL_CALLOC(PROFILER_TRACE_LINE_LENGTH*(profiler.frameCount*6 + profiler.eventCount) + 1024, sizeof(char));
+
+    int byteCount = 0;
+    byteCount += sprintf(json + byteCount, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    byteCount += sprintf(json + byteCount, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"raylib\"}},\n");
+    byteCount += sprintf(json + byteCount, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n");
+    byteCount += sprintf(json + byteCount, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}");
+
+    for (int i = profiler.frameCount - 1; i >= 0; i--)
+    {
+        ProfilerFrame frame = GetProfilerFrame(i);
+        double start = frame.start*1000000.0;
+        double update = frame.updateTime*1000000.0;
+        double draw = frame.drawTime*1000000.0;
+        double swap = frame.swapTime*1000000.0;
+
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", start, update + draw + swap);
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Update\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", start, update);
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Draw\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", start + update, draw);
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Swap\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", start + update + draw, swap);
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Render\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"drawCalls\":%i,\"vertices\":%i,\"textureBinds\":%i,\"bufferBytes\":%i}}",
+            start, frame.drawCalls, frame.vertices, frame.textureBinds, frame.bufferBytes);
+
+        // NOTE: GPU clock is not synchronized with CPU clock, GPU time is placed at frame draw start
+        if (frame.gpuTime > 0.0) byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"Render batches\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":%.3f,\"dur\":%.3f}", start + update, frame.gpuTime*1000000.0);
+    }
+
+    for (int i = profiler.eventCount - 1; i >= 0; i--)
+    {
+        ProfilerEvent *event = &profiler.events[(profiler.eventHead - 1 - i + MAX_PROFILER_EVENTS)%MAX_PROFILER_EVENTS];
+
+        // Scope names are escaped for JSON strings
+        char name[MAX_PROFILER_SCOPE_NAME_LENGTH] = { 0 };
+        strcpy(name, profiler.names[event->name]);
+        for (int c = 0; name[c] != '\0'; c++) if ((name[c] == '\"') || (name[c] == '\\') || ((unsigned char)name[c] < 32)) name[c] = '_';
+
+        byteCount += snprintf(json + byteCount, PROFILER_TRACE_LINE_LENGTH, ",\n{\"name\":\"%s\",\"cat\":\"scope\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+            name, event->start*1000000.0, event->duration*1000000.0);
+    }
+
+    byteCount += sprintf(json + byteCount, "\n]}\n");
+
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = SaveFileText(fileName, json);
+
+    RL_FREE(json);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Trace exported successfully (%i frames, %i scopes)", fileName, profiler.frameCount, profiler.eventCount);
+    else TRACELOG(LOG_WARNING, "PROFILER: [%s] Failed to export trace", fileName);
+#endif
+
+    return success;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Input Handling: Keyboard
 //----------------------------------------------------------------------------------
@@ -3537,6 +3908,99 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_PROFILER)
+// Get profile scope name index, name is added if not found
+// NOTE: Returns -1 if names table is full
+static int GetProfileScopeName(const char *name)
+{
+    for (int i = 0; i < profiler.nameCount; i++)
+    {
+        if (strncmp(profiler.names[i], name, MAX_PROFILER_SCOPE_NAME_LENGTH - 1) == 0) return i;
+    }
+
+    if (profiler.nameCount == MAX_PROFILER_SCOPE_NAMES)
+    {
+        TRACELOG(LOG_WARNING, "PROFILER: Maximum profile scope names reached (%i), scope not measured: %s", MAX_PROFILER_SCOPE_NAMES, name);
+        return -1;
+    }
+
+    strncpy(profiler.names[profiler.nameCount], name, MAX_PROFILER_SCOPE_NAME_LENGTH - 1);
+    profiler.nameCount++;
+
+    return profiler.nameCount - 1;
+}
+
+// Measure render batches draws, set as rlgl render batch callback
+// NOTE: Render batches draws are profile scopes, their time is also added to the frame batch time
+static void ProfileRenderBatch(bool begin)
+{
+    if (begin) BeginProfileScope("rlDrawRenderBatch");
+    else
+    {
+        if ((profiler.scopeDepth > 0) && (profiler.scopeDepth <= MAX_PROFILER_SCOPE_DEPTH)) profiler.batchTime += GetTime() - profiler.scopeStarts[profiler.scopeDepth - 1];
+        EndProfileScope();
+    }
+}
+
+// End profiler frame, at the end of EndDrawing()
+// NOTE: rlgl render stats are reset for the next frame, GPU timer results arrive some frames later
+// and they are added to the frame they were issued on
+static void EndProfilerFrame(void)
+{
+    double time = GetTime();
+    rlRenderStats stats = rlGetRenderStats();
+
+    ProfilerFrame *frame = &profiler.frames[profiler.frameHead];
+    frame->start = profiler.frameStart;
+    frame->updateTime = profiler.drawStart - profiler.frameStart;
+    frame->drawTime = profiler.swapStart - profiler.drawStart;
+    frame->batchTime = profiler.batchTime;
+    frame->swapTime = time - profiler.swapStart;
+    frame->drawCalls = stats.drawCalls;
+    frame->vertices = stats.vertices;
+    frame->textureBinds = stats.textureBinds;
+    frame->bufferBytes = stats.bufferBytes;
+
+    // GPU time is not available if some render batches were not timed (no GPU timer support or no queries free)
+    profiler.statsFrames[profiler.frameHead] = stats.frame;
+    profiler.gpuPending[profiler.frameHead] = (stats.gpuTimers < stats.batchDraws)? -1 : stats.gpuTimers;
+    profiler.gpuTimes[profiler.frameHead] = 0.0;
+    frame->gpuTime = (profiler.gpuPending[profiler.frameHead] == 0)? 0.0 : -1.0;
+
+    profiler.frameHead = (profiler.frameHead + 1)%MAX_PROFILER_FRAMES;
+    if (profiler.frameCount < MAX_PROFILER_FRAMES) profiler.frameCount++;
+
+    profiler.frameStart = time;
+    profiler.drawStart = time;
+    profiler.swapStart = time;
+    profiler.batchTime = 0.0;
+    rlResetRenderStats();
+
+    // Collect finished GPU timers
+    unsigned int statsFrame = 0;
+    double gpuTime = 0.0;
+
+    while (rlGetGpuTimerResult(&statsFrame, &gpuTime))
+    {
+        for (int i = 0; i < profiler.frameCount; i++)
+        {
+            int index = (profiler.frameHead - 1 - i + MAX_PROFILER_FRAMES)%MAX_PROFILER_FRAMES;
+
+            if (profiler.statsFrames[index] == statsFrame)
+            {
+                if (profiler.gpuPending[index] > 0)
+                {
+                    profiler.gpuTimes[index] += gpuTime;
+                    profiler.gpuPending[index]--;
+                    if (profiler.gpuPending[index] == 0) profiler.frames[index].gpuTime = profiler.gpuTimes[index];
+                }
+                break;
+            }
+        }
+    }
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
@@ -51,11 +51,15 @@
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_MAPPED_BUFFERS       3    // Minimum number of batch buffers when they are persistently mapped (GL_ARB_buffer_storage)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_SHAPES            4096    // Default number of SDF shapes per render batch
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_BONES                 128    // Maximum number of bones matrices in default skinning shader (less if vertex uniforms do not fit them)
+*       #define RL_MAX_GPU_TIMER_QUERIES             64    // Maximum number of GPU timer queries waiting for results
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -68,12 +72,15 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 7
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 8
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bones skinning matrices array (GPU skinning)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -124,6 +131,15 @@
     #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
 #endif
 
+// Thread local storage specifier, per thread rlgl state (render batch recorders)
+#ifndef RL_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#endif
+
 // Support TRACELOG macros
 #ifndef TRACELOG
     #define TRACELOG(level, ...) (void)0
@@ -211,12 +227,18 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_MAPPED_BUFFERS
+    #define RL_DEFAULT_BATCH_MAPPED_BUFFERS          3      // Minimum number of batch buffers when they are persistently mapped (GL_ARB_buffer_storage)
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_SHAPES
+    #define RL_DEFAULT_BATCH_SHAPES               4096      // Default number of SDF shapes per render batch
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -227,6 +249,14 @@
 #ifndef RL_MAX_SHADER_LOCATIONS
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
+#ifndef RL_MAX_SHADER_BONES
+    #define RL_MAX_SHADER_BONES                    128      // Maximum number of bones matrices in default skinning shader (less if vertex uniforms do not fit them)
+#endif
+
+// GPU timer queries
+#ifndef RL_MAX_GPU_TIMER_QUERIES
+    #define RL_MAX_GPU_TIMER_QUERIES                64      // Maximum number of GPU timer queries waiting for results
+#endif
 
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
@@ -340,6 +370,13 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved batch vertex (RL_BATCH_LAYOUT_COMPACT), 20 bytes
+typedef struct rlBatchVertex {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    unsigned short u, v;        // Vertex texture coordinates, normalized 16 bit (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color, normalized 8 bit (shader-location = 3)
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
@@ -347,6 +384,7 @@ typedef struct rlVertexBuffer {
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    rlBatchVertex *packed;      // Interleaved vertex data, replaces the three arrays above (RL_BATCH_LAYOUT_COMPACT)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -355,6 +393,9 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+#if defined(GRAPHICS_API_OPENGL_33)
+    void *fence;                // OpenGL sync object (GLsync) set after the last draw from this buffer (persistent mapped batches only)
+#endif
 } rlVertexBuffer;
 
 // Draw call type
@@ -368,6 +409,8 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, lower layers are drawn first when draw sorting is enabled
+    int shapeCount;             // Number of SDF shapes drawn before the vertex data of this draw (see rlShapeCircleSDF())
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -378,12 +421,39 @@ typedef struct rlRenderBatch {
     int bufferCount;            // Number of vertex buffers (multi-buffering support)
     int currentBuffer;          // Current buffer tracking in case of multi-buffering
     rlVertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
+    int layout;                 // Vertex data layout (rlBatchLayout)
+    bool persistentMapped;      // Vertex data is written straight into persistently mapped GPU buffers
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Render batch vertex data layout
+typedef enum {
+    RL_BATCH_LAYOUT_DEFAULT = 0,    // One array per attribute: position (float3), texcoord (float2), color (RGBA8), 24 bytes per vertex
+    RL_BATCH_LAYOUT_COMPACT         // Interleaved rlBatchVertex: position (float3), texcoord (unorm16x2), color (RGBA8), 20 bytes per vertex
+} rlBatchLayout;
+
+// Render batch recorder
+// NOTE: Records draw calls and vertex data on any thread with no GL calls,
+// they are drawn later on the render thread, see rlBeginRecording()
+typedef struct rlRecorder rlRecorder;
+
+// Render statistics, counted since last rlResetRenderStats()
+typedef struct rlRenderStats {
+    int batchDraws;             // Render batches drawn with vertex data
+    int drawCalls;              // Draw calls issued (render batch draw calls and vertex arrays draws)
+    int vertices;               // Vertex drawn (instances vertex included)
+    int textureBinds;           // Textures bound for drawing
+    int bufferBytes;            // Vertex data bytes uploaded to GPU buffers (or written into persistently mapped buffers)
+    int gpuTimers;              // Render batches draws timed on the GPU (see rlEnableGpuTimer())
+    unsigned int frame;         // Stats frame, number of rlResetRenderStats() calls
+} rlRenderStats;
+
+// Render batch draw callback, called before (begin = true) and after (begin = false) drawing a render batch with vertex data
+typedef void (*rlRenderBatchCallback)(bool begin);
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -487,7 +557,10 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,          // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,       // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,        // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF              // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_VERTEX_BONEIDS,       // Shader location: vertex attribute: bone ids
+    RL_SHADER_LOC_VERTEX_BONEWEIGHTS,   // Shader location: vertex attribute: bone weights
+    RL_SHADER_LOC_BONE_MATRICES         // Shader location: matrix array uniform: bones skinning matrices
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE       RL_SHADER_LOC_MAP_ALBEDO
@@ -580,6 +653,10 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertexArray2f(const float *vertices, int count);    // Define vertices (position) from an array - 2 float per vertex
+RLAPI void rlVertexArray3f(const float *vertices, int count);    // Define vertices (position) from an array - 3 float per vertex
+RLAPI void rlVertexArray2fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count); // Define vertices (position, texcoord, color) from arrays - 2 float per position, NULL texcoords/colors use current ones
+RLAPI void rlVertexArray3fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count); // Define vertices (position, texcoord, color) from arrays - 3 float per position, NULL texcoords/colors use current ones
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -667,10 +744,17 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdDefaultSkinning(void);  // Get default skinning shader id (loaded on first call, 0 if not supported)
+RLAPI int *rlGetShaderLocsDefaultSkinning(void);        // Get default skinning shader locations
+RLAPI int rlGetShaderBonesDefaultSkinning(void);        // Get default skinning shader max bones (bone matrices array size)
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
+RLAPI void rlSetRenderBatchLayout(int layout);                              // Set vertex data layout for render batches loaded afterwards, call before rlglInit() for the default batch
+RLAPI void rlEnableDrawSorting(void);                                       // Enable draw calls sorting: draw calls are reordered by layer, mode and texture and merged when the batch is drawn
+RLAPI void rlDisableDrawSorting(void);                                      // Disable draw calls sorting: draw calls are drawn in submission order (default)
+RLAPI void rlSetDrawLayer(int layer);                                       // Set draw layer for the following draw calls (only used with draw calls sorting)
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
@@ -678,8 +762,31 @@ RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // S
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
 
+// Render batch recorders
+// NOTE: Load, submit and unload them on the render thread, record on any thread
+RLAPI rlRecorder *rlLoadRecorder(void);                                     // Load a render batch recorder
+RLAPI void rlUnloadRecorder(rlRecorder *recorder);                          // Unload a render batch recorder
+RLAPI void rlBeginRecording(rlRecorder *recorder);                          // Begin recording into a recorder on the calling thread (previous recording is cleared)
+RLAPI void rlEndRecording(void);                                            // End recording on the calling thread
+RLAPI void rlSubmitRecorder(rlRecorder *recorder);                          // Add recorded draw calls to the current render batch (can be submitted many times)
+
+// Render statistics and timing
+RLAPI rlRenderStats rlGetRenderStats(void);                                 // Get render statistics counted since last reset
+RLAPI void rlResetRenderStats(void);                                        // Reset render statistics and start a new stats frame
+RLAPI void rlEnableGpuTimer(void);                                          // Enable render batches draws timing on the GPU (GL_TIME_ELAPSED queries)
+RLAPI void rlDisableGpuTimer(void);                                         // Disable render batches draws timing on the GPU
+RLAPI bool rlGetGpuTimerResult(unsigned int *frame, double *time);          // Get next finished GPU timer result: stats frame it was issued on and GPU time in seconds (does not wait)
+RLAPI void rlSetRenderBatchCallback(rlRenderBatchCallback callback);        // Set callback called around render batches draws (NULL to disable)
+
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// SDF shapes, drawn as one instanced quad each with current color (no texture), in order with the render batch
+// NOTE: Every run of shapes between other drawing is one more draw call of the batch, but it does not draw the batch
+// NOTE: They return false if the shape can not be drawn this way (no OpenGL 3.3/ES3, recording thread,
+// custom shader active or transform matrix not keeping shapes proportions), so it can be tessellated instead
+RLAPI bool rlShapeCircleSDF(float x, float y, float radius, float thickness, float startAngle, float endAngle);   // Add circle, ring (thickness > 0) or their sectors (angles in degrees)
+RLAPI bool rlShapeBoxSDF(float x, float y, float halfWidth, float halfHeight, float rotation, float cornerRadius, float thickness);  // Add rotated rounded box or its outline (thickness > 0)
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -725,6 +832,7 @@ RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName);
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count);  // Set shader value matrices array
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
@@ -831,7 +939,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
-#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), atan2f(), fabsf(), floor(), log()
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>              // Required for: SSE intrinsics [Used in rlVertexArray*()]
+    #define RLGL_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>               // Required for: NEON intrinsics [Used in rlVertexArray*()]
+    #define RLGL_SIMD_NEON
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -929,6 +1045,12 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 7
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 8
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -948,6 +1070,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bones skinning matrices array (GPU skinning)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -962,12 +1087,24 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// SDF shape instance data
+typedef struct rlShapeInstance {
+    float bounds[4];                // Center position (XY) and half size (box) or radius (circle)
+    float shape[4];                 // Rotation cosine and sine, radius (box corners or circle) and thickness (0 when filled)
+    float arc[4];                   // Arc start and end angles (radians, circles only), shape type and depth
+    unsigned char color[4];         // Color (RGBA)
+} rlShapeInstance;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
+    rlRecorder *recorder;                   // Recorder this state records into (NULL on the render thread)
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
+        int batchLayout;                    // Vertex data layout for render batches loaded from now on (rlBatchLayout)
+        bool drawSorting;                   // Sort and merge batch draw calls before drawing them
+        int drawLayer;                      // Draw layer for new draw calls
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
@@ -987,6 +1124,10 @@ typedef struct rlglData {
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
+        unsigned int skinningShaderId;      // Default skinning shader program id, default shader plus bones skinning (loaded on first use)
+        int *skinningShaderLocs;            // Default skinning shader locations pointer
+        int skinningShaderBones;            // Default skinning shader bone matrices array size
+        bool skinningShaderFailed;          // Default skinning shader could not be loaded, it is not tried again
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
@@ -1028,13 +1169,49 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistent mapped buffers support (GL_ARB_buffer_storage)
+        bool timerQuery;                    // GPU timer queries support (GL_ARB_timer_query, core on OpenGL 3.3)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        rlRenderStats counters;             // Render statistics since last reset
+        rlRenderBatchCallback batchCallback;// Callback called around render batches draws
+        bool gpuTimer;                      // Time render batches draws on the GPU
+        unsigned int queries[RL_MAX_GPU_TIMER_QUERIES];     // GPU timer queries ring buffer (GL_TIME_ELAPSED)
+        unsigned int queryFrames[RL_MAX_GPU_TIMER_QUERIES]; // Stats frame every pending query was issued on
+        int queryHead;                      // Next query to issue
+        int queryCount;                     // Queries waiting for results
+    } Stats;            // Render statistics and timing
+    struct {
+        rlShapeInstance *instances;         // SDF shape instances waiting to be drawn, in current batch draw calls order
+        int count;                          // SDF shape instances count
+        int attribLocs[4];                  // SDF shapes instance attributes locations (bounds, shape, arc, color)
+        unsigned int vaoId;                 // SDF shapes vertex array object (quad corners come from gl_VertexID)
+        unsigned int vboId;                 // SDF shapes instance buffer
+        unsigned int shaderId;              // SDF shapes shader program id
+        int mvpLoc;                         // SDF shapes shader MVP matrix location
+        bool failed;                        // SDF shapes could not be loaded, they are not tried again
+    } Shapes;           // SDF shapes drawing
 } rlglData;
 
+// Render batch recorder data
+// NOTE: The recorder owns the rlgl state used by the recording thread, its default batch is CPU only and
+// instead of being drawn when full, its content is moved into the recorded arrays (see rlRecordRenderBatch())
+struct rlRecorder {
+    rlglData state;                         // rlgl state of the recording thread
+    float *vertices;                        // Recorded vertex positions (XYZ - 3 components per vertex)
+    float *texcoords;                       // Recorded vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char *colors;                  // Recorded vertex colors (RGBA - 4 components per vertex)
+    int vertexCount;                        // Recorded vertex count
+    int vertexCapacity;                     // Recorded vertex arrays capacity
+    rlDrawCall *draws;                      // Recorded draw calls (no alignment, vertex data is contiguous)
+    int drawCount;                          // Recorded draw calls count
+    int drawCapacity;                       // Recorded draw calls array capacity
+};
+
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1043,7 +1220,18 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-static rlglData RLGL = { 0 };
+static rlglData rlglRender = { 0 };         // rlgl state of the render thread
+
+// rlgl state of the calling thread, the render thread state unless the thread is recording
+// NOTE: Initial-exec TLS model keeps the access cheap in executables, it is only used when not building
+// position independent code for a shared library: a library loaded with dlopen() could fail to load
+#if defined(__GNUC__) && !defined(BUILD_LIBTYPE_SHARED) && (!defined(__PIC__) || defined(__PIE__))
+static RL_THREAD_LOCAL rlglData *rlglCurrent __attribute__((tls_model("initial-exec"))) = &rlglRender;
+#else
+static RL_THREAD_LOCAL rlglData *rlglCurrent = &rlglRender;
+#endif
+
+#define RLGL (*rlglCurrent)
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
@@ -1062,8 +1250,23 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlVertexArray(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int count); // Define vertices from arrays
+static void rlTransformVertices(const float *vertices, int components, float *result, int count);  // Transform vertex positions to the batch (XYZ)
+static void rlSortRenderBatch(rlRenderBatch *batch, int drawCount);  // Sort and merge the first draw calls of a render batch
+static void rlRecordRenderBatch(rlRenderBatch *batch);  // Move recorder batch content into the recorded arrays and reset the batch
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShaderDefaultSkinning(void);      // Load default skinning shader
+static void rlUnloadShaderDefaultSkinning(void);    // Unload default skinning shader
+static bool rlAddShapeSDF(int type, float x, float y, float halfWidth, float halfHeight, float rotation, float radius, float thickness, float startAngle, float endAngle);  // Add SDF shape instance
+static bool rlLoadShapesSDF(void);          // Load SDF shapes shader and buffers
+static void rlUnloadShapesSDF(void);        // Unload SDF shapes shader and buffers
+static void rlUpdateShapesSDF(void);        // Update SDF shapes instance buffer with instances waiting to be drawn
+static void rlDrawShapesSDF(int offset, int count);  // Draw a run of SDF shape instances
+static void *rlMapBatchBuffer(int size);    // Allocate persistent mapped storage for the bound vertex buffer
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlWaitBatchBuffer(rlVertexBuffer *buffer);  // Wait for the GPU to finish reading a persistent mapped vertex buffer
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1342,6 +1545,27 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+
+void rlVertexArray2f(const float *vertices, int count) { rlVertexArray2fEx(vertices, NULL, NULL, count); }
+void rlVertexArray3f(const float *vertices, int count) { rlVertexArray3fEx(vertices, NULL, NULL, count); }
+void rlVertexArray2fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (texcoords != NULL) glTexCoord2fv(texcoords + 2*i);
+        if (colors != NULL) glColor4ubv(colors + 4*i);
+        glVertex2fv(vertices + 2*i);
+    }
+}
+void rlVertexArray3fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (texcoords != NULL) glTexCoord2fv(texcoords + 2*i);
+        if (colors != NULL) glColor4ubv(colors + 4*i);
+        glVertex3fv(vertices + 3*i);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1369,11 +1593,17 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            // With draw sorting, draw calls are merged first and the batch is only drawn if none could be merged
+            if (RLGL.State.drawSorting) rlSortRenderBatch(RLGL.currentBatch, RLGL.currentBatch->drawCounter - 1);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
     }
 }
 
@@ -1427,6 +1657,29 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    if (RLGL.currentBatch->layout == RL_BATCH_LAYOUT_COMPACT)
+    {
+        // Add vertex, texcoord and color interleaved
+        // NOTE: Texcoords are stored normalized, values out of [0..1] are clamped
+        rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].packed[RLGL.State.vertexCounter];
+        float u = (RLGL.State.texcoordx < 0.0f)? 0.0f : ((RLGL.State.texcoordx > 1.0f)? 1.0f : RLGL.State.texcoordx);
+        float v = (RLGL.State.texcoordy < 0.0f)? 0.0f : ((RLGL.State.texcoordy > 1.0f)? 1.0f : RLGL.State.texcoordy);
+
+        vertex->x = tx;
+        vertex->y = ty;
+        vertex->z = tz;
+        vertex->u = (unsigned short)(u*65535.0f + 0.5f);
+        vertex->v = (unsigned short)(v*65535.0f + 0.5f);
+        vertex->r = RLGL.State.colorr;
+        vertex->g = RLGL.State.colorg;
+        vertex->b = RLGL.State.colorb;
+        vertex->a = RLGL.State.colora;
+
+        RLGL.State.vertexCounter++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+        return;
+    }
+
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1498,6 +1751,30 @@ void rlColor3f(float x, float y, float z)
     rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
 }
 
+// Define vertices (position) from an array, 2 float per vertex
+void rlVertexArray2f(const float *vertices, int count)
+{
+    rlVertexArray(vertices, 2, NULL, NULL, count);
+}
+
+// Define vertices (position) from an array, 3 float per vertex
+void rlVertexArray3f(const float *vertices, int count)
+{
+    rlVertexArray(vertices, 3, NULL, NULL, count);
+}
+
+// Define vertices (position, texcoord, color) from arrays, 2 float per position
+void rlVertexArray2fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlVertexArray(vertices, 2, texcoords, colors, count);
+}
+
+// Define vertices (position, texcoord, color) from arrays, 3 float per position
+void rlVertexArray3fEx(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlVertexArray(vertices, 3, texcoords, colors, count);
+}
+
 #endif
 
 //--------------------------------------------------------------------------------------
@@ -1546,15 +1823,43 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                // With draw sorting, draw calls are merged first and the batch is only drawn if none could be merged
+                if (RLGL.State.drawSorting) rlSortRenderBatch(RLGL.currentBatch, RLGL.currentBatch->drawCounter - 1);
+                if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
         }
 #endif
     }
 }
 
+// Add SDF circle, ring (thickness > 0) or their sectors
+// NOTE: Angles in degrees, same as rshapes, a sweep of 360 degrees or more draws the full circle
+bool rlShapeCircleSDF(float x, float y, float radius, float thickness, float startAngle, float endAngle)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = rlAddShapeSDF(0, x, y, radius, radius, 0.0f, radius, thickness, startAngle, endAngle);
+#endif
+    return result;
+}
+
+// Add SDF rotated rounded box or its outline (thickness > 0), rotated around its center
+// NOTE: Outline is inside the box bounds, rotation in degrees
+bool rlShapeBoxSDF(float x, float y, float halfWidth, float halfHeight, float rotation, float cornerRadius, float thickness)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = rlAddShapeSDF(1, x, y, halfWidth, halfHeight, rotation, cornerRadius, thickness, 0.0f, 360.0f);
+#endif
+    return result;
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -1570,6 +1875,9 @@ void rlEnableTexture(unsigned int id)
     glEnable(GL_TEXTURE_2D);
 #endif
     glBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.counters.textureBinds++;
+#endif
 }
 
 // Disable texture
@@ -2122,7 +2430,13 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    // NOTE: Persistent mapped buffers are written in place, so they get enough of them for the
+    // GPU to read the previous batches while the next one is filled
+    int batchBuffers = RL_DEFAULT_BATCH_BUFFERS;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.bufferStorage && (batchBuffers < RL_DEFAULT_BATCH_MAPPED_BUFFERS)) batchBuffers = RL_DEFAULT_BATCH_MAPPED_BUFFERS;
+#endif
+    RLGL.defaultBatch = rlLoadRenderBatch(batchBuffers, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -2183,7 +2497,13 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    rlUnloadShaderDefaultSkinning();  // Unload default skinning shader
     rlUnloadShaderDefault();          // Unload default shader
+    rlUnloadShapesSDF();              // Unload SDF shapes shader and buffers
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.Stats.queries[0] != 0) glDeleteQueries(RL_MAX_GPU_TIMER_QUERIES, RLGL.Stats.queries);  // Unload GPU timer queries
+#endif
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
@@ -2241,6 +2561,8 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;         // Persistent mapped buffers (core on OpenGL 4.4)
+    RLGL.ExtSupported.timerQuery = GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query; // GPU timer queries (core on OpenGL 3.3)
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2454,6 +2776,8 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
+    if (RLGL.ExtSupported.timerQuery) TRACELOG(RL_LOG_INFO, "GL: GPU timer queries supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2549,25 +2873,159 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get default skinning shader id
+// NOTE: Shader is loaded on first call, 0 is returned if it is not supported
+unsigned int rlGetShaderIdDefaultSkinning(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.skinningShaderId == 0) && !RLGL.State.skinningShaderFailed) rlLoadShaderDefaultSkinning();
+    id = RLGL.State.skinningShaderId;
+#endif
+    return id;
+}
+
+// Get default skinning shader locs
+int *rlGetShaderLocsDefaultSkinning(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.skinningShaderId == 0) && !RLGL.State.skinningShaderFailed) rlLoadShaderDefaultSkinning();
+    locs = RLGL.State.skinningShaderLocs;
+#endif
+    return locs;
+}
+
+// Get default skinning shader max bones
+// NOTE: Bone matrices array size depends on the vertex uniforms available, up to RL_MAX_SHADER_BONES
+int rlGetShaderBonesDefaultSkinning(void)
+{
+    int bones = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.skinningShaderId == 0) && !RLGL.State.skinningShaderFailed) rlLoadShaderDefaultSkinning();
+    bones = RLGL.State.skinningShaderBones;
+#endif
+    return bones;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
+// Set vertex data layout for render batches loaded afterwards
+// NOTE: RL_BATCH_LAYOUT_COMPACT clamps texcoords to [0..1], texture repeat through
+// texcoords out of that range requires the default layout
+void rlSetRenderBatchLayout(int layout)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((layout != RL_BATCH_LAYOUT_DEFAULT) && (layout != RL_BATCH_LAYOUT_COMPACT))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Render batch layout %i not valid, layout not changed", layout);
+        return;
+    }
+
+    if (layout == RL_BATCH_LAYOUT_COMPACT) TRACELOG(RL_LOG_WARNING, "RLGL: Render batch compact layout selected, texcoords are clamped to [0..1] (no texture repeat)");
+
+    RLGL.State.batchLayout = layout;
+#endif
+}
+
+// Enable draw calls sorting
+// NOTE: When the batch is drawn (or runs out of draw calls), draw calls are ordered by layer and
+// merged with previous ones sharing mode and texture, only moving them over draw calls they do not
+// overlap, so the drawing order is kept where it is visible
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.drawSorting = true;
+#endif
+}
+
+// Disable draw calls sorting
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.drawSorting = false;
+#endif
+}
+
+// Set draw layer for the following draw calls
+// NOTE: Layers only reorder draw calls within a batch, anything forcing a batch draw
+// (shader, matrix or framebuffer changes) also ends the layering
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if ((draw->layer != layer) && (draw->vertexCount > 0))
+    {
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        // Start a new draw call with same mode and texture, aligned as in rlBegin()
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            if (RLGL.State.drawSorting) rlSortRenderBatch(RLGL.currentBatch, RLGL.currentBatch->drawCounter - 1);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        }
+
+        draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        draw->mode = mode;
+        draw->textureId = textureId;
+        draw->vertexCount = 0;
+    }
+
+    draw->layer = layer;
+    RLGL.State.drawLayer = layer;
+#endif
+}
+
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_OPENGL_33)
+    // With persistent mapped buffers vertex data is written straight into GPU visible memory,
+    // no CPU copies of position, texcoord and color data are required
+    batch.persistentMapped = RLGL.ExtSupported.bufferStorage;
+#endif
+    batch.layout = RLGL.State.batchLayout;
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        // NOTE: Persistent mapped vertex arrays are mapped from the GPU buffers instead
+        if (!batch.persistentMapped && (batch.layout == RL_BATCH_LAYOUT_COMPACT))
+        {
+            batch.vertexBuffer[i].packed = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+        }
+        else if (!batch.persistentMapped)
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2575,10 +3033,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2611,27 +3065,48 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (batch.layout == RL_BATCH_LAYOUT_COMPACT)
+        {
+            // Quads - Interleaved vertex buffer binding and attributes enable
+            // Position (shader-location = 0), texcoord (shader-location = 1) and color (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            if (batch.persistentMapped) batch.vertexBuffer[i].packed = (rlBatchVertex *)rlMapBatchBuffer(bufferElements*4*sizeof(rlBatchVertex));
+            else glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].packed, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), 0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(3*sizeof(float) + 2*sizeof(unsigned short)));
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            if (batch.persistentMapped) batch.vertexBuffer[i].vertices = (float *)rlMapBatchBuffer(bufferElements*3*4*sizeof(float));
+            else glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            if (batch.persistentMapped) batch.vertexBuffer[i].texcoords = (float *)rlMapBatchBuffer(bufferElements*2*4*sizeof(float));
+            else glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            if (batch.persistentMapped) batch.vertexBuffer[i].colors = (unsigned char *)rlMapBatchBuffer(bufferElements*4*4*sizeof(unsigned char));
+            else glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2644,7 +3119,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #endif
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (batch.persistentMapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU), persistent mapped (%i buffers)", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2662,6 +3138,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.drawLayer;
+        batch.draws[i].shapeCount = 0;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2697,6 +3175,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Persistent mapped buffers: wait for the GPU to finish reading before deleting them,
+        // deleting a buffer also unmaps it
+        if (batch.persistentMapped) rlWaitBatchBuffer(&batch.vertexBuffer[i]);
+#endif
+
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
@@ -2707,9 +3191,13 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        if (!batch.persistentMapped)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].colors);
+            RL_FREE(batch.vertexBuffer[i].packed);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2724,48 +3212,85 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Recording threads can not draw, batch content is kept for rlSubmitRecorder()
+    if (RLGL.recorder != NULL)
+    {
+        rlRecordRenderBatch(batch);
+        return;
+    }
+
+    // Render statistics and timing, only batches with vertex data or SDF shapes are measured
+    bool measured = ((RLGL.State.vertexCounter > 0) || (RLGL.Shapes.count > 0));
+#if defined(GRAPHICS_API_OPENGL_33)
+    bool timed = false;
+#endif
+    if (measured)
+    {
+        if (RLGL.Stats.batchCallback != NULL) RLGL.Stats.batchCallback(true);
+
+        int vertexSize = (batch->layout == RL_BATCH_LAYOUT_COMPACT)? (int)sizeof(rlBatchVertex) : (int)(5*sizeof(float) + 4*sizeof(unsigned char));
+        RLGL.Stats.counters.batchDraws++;
+        RLGL.Stats.counters.bufferBytes += RLGL.State.vertexCounter*vertexSize;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        // NOTE: Batch is not timed if all queries are still waiting for results
+        if (RLGL.Stats.gpuTimer && (RLGL.Stats.queryCount < RL_MAX_GPU_TIMER_QUERIES))
+        {
+            glBeginQuery(GL_TIME_ELAPSED, RLGL.Stats.queries[RLGL.Stats.queryHead]);
+            timed = true;
+        }
+#endif
+    }
+
+    // Sort and merge draw calls, rearranging vertex data in the current buffer
+    if (RLGL.State.drawSorting && (RLGL.State.vertexCounter > 0)) rlSortRenderBatch(batch, batch->drawCounter);
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-    // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    // NOTE: Persistent mapped buffers already hold the vertex data, written by rlVertex3f()
+    if ((RLGL.State.vertexCounter > 0) && !batch->persistentMapped)
     {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+        if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId);
+
+        // NOTE: Every buffer is orphaned with glBufferData() and a NULL pointer before updating it:
+        // if the GPU is still drawing from the previous data, the driver hands over new storage
+        // instead of stalling glBufferSubData() until the GPU is done
+
+        if (batch->layout == RL_BATCH_LAYOUT_COMPACT)
+        {
+            // Interleaved vertex buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*sizeof(rlBatchVertex), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), buffer->packed);
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), buffer->vertices);
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), buffer->texcoords);
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), buffer->colors);
+        }
 
         // Unbind the current VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
     }
+
+    // Update SDF shapes instance buffer, every run of shapes is drawn from it
+    if (RLGL.Shapes.count > 0) rlUpdateShapesSDF();
     //------------------------------------------------------------------------------------------------------------
 
     // Draw batch vertex buffers (considering VR stereo if required)
@@ -2789,6 +3314,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             rlSetMatrixProjection(RLGL.State.projectionStereo[eye]);
         }
 
+        // Draw SDF shapes, without vertex data they all belong to the first draw call
+        if ((RLGL.State.vertexCounter == 0) && (RLGL.Shapes.count > 0)) rlDrawShapesSDF(0, RLGL.Shapes.count);
+
         // Draw buffers
         if (RLGL.State.vertexCounter > 0)
         {
@@ -2806,6 +3334,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else if (batch->layout == RL_BATCH_LAYOUT_COMPACT)
+            {
+                // Bind interleaved vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), 0);
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(3*sizeof(float) + 2*sizeof(unsigned short)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            }
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -2845,11 +3386,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            for (int i = 0, vertexOffset = 0, shapeOffset = 0; i < batch->drawCounter; i++)
             {
+                // Draw the SDF shapes run of this draw call, before its vertex data, and bind back the batch shader and VAO
+                if (batch->draws[i].shapeCount > 0)
+                {
+                    rlDrawShapesSDF(shapeOffset, batch->draws[i].shapeCount);
+                    shapeOffset += batch->draws[i].shapeCount;
+
+                    glUseProgram(RLGL.State.currentShaderId);
+                    if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
+                RLGL.Stats.counters.drawCalls++;
+                RLGL.Stats.counters.textureBinds++;
+                RLGL.Stats.counters.vertices += batch->draws[i].vertexCount;
+
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
                 {
@@ -2883,12 +3438,23 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Persistent mapped buffers: mark the point where the GPU is done reading this buffer
+    if (batch->persistentMapped && (RLGL.State.vertexCounter > 0))
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        if (buffer->fence != NULL) glDeleteSync((GLsync)buffer->fence);
+        buffer->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
+    RLGL.Shapes.count = 0;
 
     // Reset depth for next draw
     batch->currentDepth = -1.0f;
@@ -2903,6 +3469,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
+        batch->draws[i].shapeCount = 0;
     }
 
     // Reset active texture units for next batch
@@ -2915,6 +3483,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Persistent mapped buffers are written in place, the GPU must be done with
+    // the next buffer before new vertex data goes into it
+    if (batch->persistentMapped) rlWaitBatchBuffer(&batch->vertexBuffer[batch->currentBuffer]);
+
+    if (timed)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        RLGL.Stats.queryFrames[RLGL.Stats.queryHead] = RLGL.Stats.counters.frame;
+        RLGL.Stats.queryHead = (RLGL.Stats.queryHead + 1)%RL_MAX_GPU_TIMER_QUERIES;
+        RLGL.Stats.queryCount++;
+        RLGL.Stats.counters.gpuTimers++;
+    }
+#endif
+    if (measured && (RLGL.Stats.batchCallback != NULL)) RLGL.Stats.batchCallback(false);
 #endif
 }
 
@@ -2964,57 +3548,285 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Render batch recorders
+//------------------------------------------------------------------------------------------------
+// Load a render batch recorder
+// NOTE: Recorder state starts as a copy of the render thread state (default texture, shader...),
+// it must be loaded on the render thread, after rlglInit()
+rlRecorder *rlLoadRecorder(void)
 {
-    unsigned int id = 0;
-
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlRecorder *recorder = NULL;
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
-    }
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
-
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
-    }
+    recorder = (rlRecorder *)RL_CALLOC(1, sizeof(rlRecorder));
+    recorder->state = rlglRender;
+    recorder->state.recorder = recorder;
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
-    }
+    // Recorder default batch: one CPU only vertex buffer, no GL buffers required
+    rlRenderBatch batch = { 0 };
+    batch.bufferCount = 1;
+    batch.layout = RL_BATCH_LAYOUT_DEFAULT;
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(1, sizeof(rlVertexBuffer));
+    batch.vertexBuffer[0].elementCount = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+    batch.vertexBuffer[0].vertices = (float *)RL_MALLOC(RL_DEFAULT_BATCH_BUFFER_ELEMENTS*3*4*sizeof(float));
+    batch.vertexBuffer[0].texcoords = (float *)RL_MALLOC(RL_DEFAULT_BATCH_BUFFER_ELEMENTS*2*4*sizeof(float));
+    batch.vertexBuffer[0].colors = (unsigned char *)RL_MALLOC(RL_DEFAULT_BATCH_BUFFER_ELEMENTS*4*4*sizeof(unsigned char));
+    batch.draws = (rlDrawCall *)RL_CALLOC(RL_DEFAULT_BATCH_DRAWCALLS, sizeof(rlDrawCall));
+    batch.drawCounter = 1;
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
-    }
+    recorder->state.defaultBatch = batch;
+    recorder->state.currentBatch = &recorder->state.defaultBatch;
 #endif
-#endif  // GRAPHICS_API_OPENGL_11
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    return recorder;
+}
+
+// Unload a render batch recorder
+void rlUnloadRecorder(rlRecorder *recorder)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (recorder == NULL) return;
+
+    RL_FREE(recorder->state.defaultBatch.vertexBuffer[0].vertices);
+    RL_FREE(recorder->state.defaultBatch.vertexBuffer[0].texcoords);
+    RL_FREE(recorder->state.defaultBatch.vertexBuffer[0].colors);
+    RL_FREE(recorder->state.defaultBatch.vertexBuffer);
+    RL_FREE(recorder->state.defaultBatch.draws);
+
+    RL_FREE(recorder->vertices);
+    RL_FREE(recorder->texcoords);
+    RL_FREE(recorder->colors);
+    RL_FREE(recorder->draws);
+    RL_FREE(recorder);
+#endif
+}
+
+// Begin recording into a recorder on the calling thread
+// NOTE: Until rlEndRecording(), all batch drawing on this thread (rlBegin()/rlVertex*()/rlSetTexture(),
+// matrix stack and the raylib shapes/text/texture drawing helpers built on them) goes to the recorder
+// instead of the render batch. The thread starts with identity matrices, white color and layer 0;
+// anything requiring GL calls (shaders, blending, framebuffers, meshes) must stay on the render thread
+// and matrix changes outside rlPushMatrix()/rlPopMatrix() have no effect once submitted
+void rlBeginRecording(rlRecorder *recorder)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlglData *state = &recorder->state;
+    rlRenderBatch *batch = &state->defaultBatch;
+
+    recorder->vertexCount = 0;
+    recorder->drawCount = 0;
+
+    state->currentBatch = batch;
+    state->State.vertexCounter = 0;
+    state->State.drawSorting = false;
+    state->State.drawLayer = 0;
+    state->State.texcoordx = 0.0f;
+    state->State.texcoordy = 0.0f;
+    state->State.colorr = 255;
+    state->State.colorg = 255;
+    state->State.colorb = 255;
+    state->State.colora = 255;
+
+    state->State.currentMatrixMode = RL_MODELVIEW;
+    state->State.modelview = rlMatrixIdentity();
+    state->State.projection = rlMatrixIdentity();
+    state->State.transform = rlMatrixIdentity();
+    state->State.currentMatrix = &state->State.modelview;
+    state->State.transformRequired = false;
+    state->State.stackCounter = 0;
+    state->State.stereoRender = false;
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].textureId = state->State.defaultTextureId;
+        batch->draws[i].layer = 0;
+        batch->draws[i].shapeCount = 0;
+    }
+    batch->drawCounter = 1;
+    batch->currentDepth = -1.0f;
+
+    rlglCurrent = state;
+#endif
+}
+
+// End recording on the calling thread
+void rlEndRecording(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.recorder == NULL) return;
+
+    rlRecordRenderBatch(RLGL.currentBatch);
+    rlglCurrent = &rlglRender;
+#endif
+}
+
+// Add recorded draw calls to the current render batch
+// NOTE: Recorded vertex data goes through rlVertexArray*(), as if it were drawn at this point: current
+// transform applies and draw calls sorting may merge it with the rest of the batch. Recorders are
+// submitted in the order this function is called, which is the order they are drawn in
+void rlSubmitRecorder(rlRecorder *recorder)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int layer = RLGL.State.drawLayer;
+
+    for (int i = 0, offset = 0; i < recorder->drawCount; i++)
+    {
+        rlDrawCall *draw = &recorder->draws[i];
+
+        rlSetDrawLayer(draw->layer);
+        rlBegin(draw->mode);
+        rlSetTexture(draw->textureId);
+
+        // NOTE: A draw call started by rlSetTexture() keeps the mode of its slot, not the current one
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = draw->mode;
+
+        rlVertexArray(recorder->vertices + 3*offset, 3, recorder->texcoords + 2*offset, recorder->colors + 4*offset, draw->vertexCount);
+        rlEnd();
+
+        offset += draw->vertexCount;
+    }
+
+    rlSetTexture(0);
+    rlSetDrawLayer(layer);
+#endif
+}
+
+// Get render statistics counted since last reset
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats.counters;
+#endif
+    return stats;
+}
+
+// Reset render statistics and start a new stats frame
+// NOTE: GPU timer results keep the stats frame they were issued on
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int frame = RLGL.Stats.counters.frame;
+    memset(&RLGL.Stats.counters, 0, sizeof(rlRenderStats));
+    RLGL.Stats.counters.frame = frame + 1;
+#endif
+}
+
+// Enable render batches draws timing on the GPU
+// NOTE: Every render batch draw with vertex data is wrapped in a GL_TIME_ELAPSED query,
+// results are available some frames later, see rlGetGpuTimerResult()
+void rlEnableGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        if (RLGL.Stats.queries[0] == 0) glGenQueries(RL_MAX_GPU_TIMER_QUERIES, RLGL.Stats.queries);
+        RLGL.Stats.gpuTimer = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "GL: GPU timer queries not supported");
+#endif
+}
+
+// Disable render batches draws timing on the GPU
+// NOTE: Results of queries already issued can still be retrieved
+void rlDisableGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    RLGL.Stats.gpuTimer = false;
+#endif
+}
+
+// Get next finished GPU timer result, in issue order
+// NOTE: Returns false if there are no queries pending or the oldest one is not finished yet
+bool rlGetGpuTimerResult(unsigned int *frame, double *time)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.Stats.queryCount > 0)
+    {
+        int tail = (RLGL.Stats.queryHead - RLGL.Stats.queryCount + RL_MAX_GPU_TIMER_QUERIES)%RL_MAX_GPU_TIMER_QUERIES;
+        GLint available = 0;
+        glGetQueryObjectiv(RLGL.Stats.queries[tail], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available)
+        {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(RLGL.Stats.queries[tail], GL_QUERY_RESULT, &elapsed);
+
+            if (frame != NULL) *frame = RLGL.Stats.queryFrames[tail];
+            if (time != NULL) *time = (double)elapsed*1e-9;
+            RLGL.Stats.queryCount--;
+            result = true;
+        }
+    }
+#endif
+
+    return result;
+}
+
+// Set callback called around render batches draws
+void rlSetRenderBatchCallback(rlRenderBatchCallback callback)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.batchCallback = callback;
+#endif
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif  // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     glGenTextures(1, &id);              // Generate texture id
 
@@ -3660,6 +4472,7 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.counters.bufferBytes += dataSize;
 #endif
 }
 
@@ -3670,6 +4483,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.counters.bufferBytes += dataSize;
 #endif
 }
 
@@ -3715,6 +4529,10 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count;
+#endif
 }
 
 // Draw vertex array elements
@@ -3725,6 +4543,10 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3732,6 +4554,8 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count*instances;
 #endif
 }
 
@@ -3744,6 +4568,8 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count*instances;
 #endif
 }
 
@@ -3976,6 +4802,10 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    glBindAttribLocation(program, 8, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+#endif
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
@@ -4103,6 +4933,27 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
 #endif
 }
 
+// Set shader value matrices array
+void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // NOTE: Matrix struct stores rows (m0, m4, m8, m12...), they are transposed on upload
+    glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 does not support transposing matrices on upload
+    float *matfloat = (float *)RL_MALLOC(count*16*sizeof(float));
+
+    for (int i = 0; i < count; i++)
+    {
+        const float *rows = (const float *)&matrices[i];
+        for (int k = 0; k < 16; k++) matfloat[i*16 + k] = rows[(k%4)*4 + k/4];
+    }
+
+    glUniformMatrix4fv(locIndex, count, false, matfloat);
+    RL_FREE(matfloat);
+#endif
+}
+
 // Set shader value uniform sampler
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
 {
@@ -4688,6 +5539,1017 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load default skinning shader (default shader plus bones skinning)
+// NOTE: Vertex positions are transformed by the bone matrices blended by weight, up to 4 bones per vertex,
+// fragment shader is the default one, bone matrices are set with rlSetUniformMatrices()
+// NOTE: Loaded: RLGL.State.skinningShaderId, RLGL.State.skinningShaderLocs
+static void rlLoadShaderDefaultSkinning(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Bone matrices array is sized to the vertex uniforms available, every bone takes 16 components
+    // NOTE: Minimum guaranteed is 512 components on OpenGL 2.1 and 1024 on OpenGL 3.3 and ES3,
+    // some components are left for mvp and for driver internal use
+    int maxComponents = 0;
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_VECTORS, &maxComponents);
+    maxComponents *= 4;
+#else
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &maxComponents);
+#endif
+    int maxBones = (maxComponents - 64)/16;
+    if (maxBones > RL_MAX_SHADER_BONES) maxBones = RL_MAX_SHADER_BONES;
+
+    const char *skinningVShaderHeader =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 100                       \n"     // Same version as default fragment shader
+    "precision highp float;             \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 boneMatrices[";       // Array size appended on loading
+
+    const char *skinningVShaderBody =
+    "]; \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    mat4 skinMatrix = vertexBoneWeights.x*boneMatrices[int(vertexBoneIds.x)] + \n"
+    "        vertexBoneWeights.y*boneMatrices[int(vertexBoneIds.y)] + \n"
+    "        vertexBoneWeights.z*boneMatrices[int(vertexBoneIds.z)] + \n"
+    "        vertexBoneWeights.w*boneMatrices[int(vertexBoneIds.w)]; \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*skinMatrix*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    unsigned int vShaderId = 0;
+
+    if (maxBones > 0)
+    {
+        // Compose shader code: header, bones array size digits and body
+        char bonesDigits[12] = { 0 };
+        int digitCount = 0;
+        for (int bones = maxBones; bones > 0; bones /= 10) digitCount++;
+        for (int i = digitCount - 1, bones = maxBones; i >= 0; i--, bones /= 10) bonesDigits[i] = (char)('0' + bones%10);
+
+        size_t headerLength = strlen(skinningVShaderHeader);
+        size_t bodyLength = strlen(skinningVShaderBody);
+        char *skinningVShaderCode = (char *)RL_MALLOC(headerLength + digitCount + bodyLength + 1);
+        memcpy(skinningVShaderCode, skinningVShaderHeader, headerLength);
+        memcpy(skinningVShaderCode + headerLength, bonesDigits, digitCount);
+        memcpy(skinningVShaderCode + headerLength + digitCount, skinningVShaderBody, bodyLength + 1);
+
+        vShaderId = rlCompileShader(skinningVShaderCode, GL_VERTEX_SHADER);
+        RL_FREE(skinningVShaderCode);
+    }
+
+
+    if (vShaderId != 0)
+    {
+        RLGL.State.skinningShaderId = rlLoadShaderProgram(vShaderId, RLGL.State.defaultFShaderId);
+        glDeleteShader(vShaderId);  // Deleted along with program
+    }
+
+    if (RLGL.State.skinningShaderId > 0)
+    {
+        RLGL.State.skinningShaderBones = maxBones;
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default skinning shader loaded successfully (%i bones)", RLGL.State.skinningShaderId, maxBones);
+
+        RLGL.State.skinningShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.skinningShaderLocs[i] = -1;
+
+        // Set default skinning shader locations: attributes locations
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexPosition");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexTexCoord");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexColor");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_BONEIDS] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexBoneIds");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_BONEWEIGHTS] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexBoneWeights");
+
+        // Set default skinning shader locations: uniform locations
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.skinningShaderId, "mvp");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.skinningShaderId, "colDiffuse");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.skinningShaderId, "texture0");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_BONE_MATRICES] = glGetUniformLocation(RLGL.State.skinningShaderId, "boneMatrices");
+    }
+#endif
+
+    if (RLGL.State.skinningShaderId == 0)
+    {
+        RLGL.State.skinningShaderFailed = true;
+        TRACELOG(RL_LOG_WARNING, "SHADER: Default skinning shader not available (OpenGL 2.1, 3.3 or ES3 required), models are skinned on CPU");
+    }
+}
+
+// Unload default skinning shader
+// NOTE: Unloads: RLGL.State.skinningShaderId, RLGL.State.skinningShaderLocs
+static void rlUnloadShaderDefaultSkinning(void)
+{
+    if (RLGL.State.skinningShaderId > 0)
+    {
+        glUseProgram(0);
+        glDeleteProgram(RLGL.State.skinningShaderId);
+        RL_FREE(RLGL.State.skinningShaderLocs);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default skinning shader unloaded successfully", RLGL.State.skinningShaderId);
+    }
+
+    RLGL.State.skinningShaderId = 0;
+    RLGL.State.skinningShaderBones = 0;
+    RLGL.State.skinningShaderLocs = NULL;
+    RLGL.State.skinningShaderFailed = false;
+}
+
+// Add SDF shape instance, type 0 is circle and type 1 is rounded box
+// NOTE: Instances are drawn before the vertex data of the draw call they are added to, a new draw call
+// is started if the current one has vertex data already, that way drawing order is kept in the batch
+static bool rlAddShapeSDF(int type, float x, float y, float halfWidth, float halfHeight, float rotation, float radius, float thickness, float startAngle, float endAngle)
+{
+    // Recording threads can not draw and custom shaders only apply to vertex data
+    if ((RLGL.recorder != NULL) || (RLGL.State.currentShaderId != RLGL.State.defaultShaderId)) return false;
+    if ((RLGL.Shapes.shaderId == 0) && (RLGL.Shapes.failed || !rlLoadShapesSDF())) return false;
+
+    float depth = RLGL.currentBatch->currentDepth;
+    float scale = 1.0f;
+
+    // Transform matrix is applied to the shape position, rotation and size when it keeps
+    // shapes proportions: translation, rotation around Z axis and uniform scale
+    if (RLGL.State.transformRequired)
+    {
+        Matrix mat = RLGL.State.transform;
+        float scaleX = sqrtf(mat.m0*mat.m0 + mat.m1*mat.m1);
+        float scaleY = sqrtf(mat.m4*mat.m4 + mat.m5*mat.m5);
+        float tolerance = 0.0001f*scaleX;
+
+        if ((fabsf(scaleX - scaleY) > tolerance) || (fabsf(mat.m0*mat.m4 + mat.m1*mat.m5) > tolerance*scaleX) ||
+            ((mat.m0*mat.m5 - mat.m1*mat.m4) <= 0.0f) || (fabsf(mat.m2) > tolerance) || (fabsf(mat.m6) > tolerance)) return false;
+
+        float tx = mat.m0*x + mat.m4*y + mat.m12;
+        y = mat.m1*x + mat.m5*y + mat.m13;
+        x = tx;
+        depth = mat.m10*depth + mat.m14;
+        rotation += atan2f(mat.m1, mat.m0)*RAD2DEG;
+        scale = scaleX;
+    }
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        // NOTE: Draw calls sorting can not move SDF shapes, with draw sorting the vertex data is drawn first
+        if (RLGL.State.drawSorting) rlDrawRenderBatch(RLGL.currentBatch);
+        else
+        {
+            int mode = draw->mode;
+            unsigned int textureId = draw->textureId;
+
+            // Start a new draw call with same mode and texture, aligned as in rlBegin()
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+            {
+                RLGL.State.vertexCounter += draw->vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            draw->mode = mode;
+            draw->textureId = textureId;
+            draw->vertexCount = 0;
+            draw->layer = RLGL.State.drawLayer;
+        }
+    }
+
+    // Make room for the new instance
+    if (RLGL.Shapes.count >= RL_DEFAULT_BATCH_SHAPES) rlDrawRenderBatch(RLGL.currentBatch);
+
+    rlShapeInstance *instance = &RLGL.Shapes.instances[RLGL.Shapes.count];
+
+    instance->bounds[0] = x;
+    instance->bounds[1] = y;
+    instance->bounds[2] = halfWidth*scale;
+    instance->bounds[3] = halfHeight*scale;
+    instance->shape[0] = 1.0f;
+    instance->shape[1] = 0.0f;
+    if (rotation != 0.0f)
+    {
+        instance->shape[0] = cosf(DEG2RAD*rotation);
+        instance->shape[1] = sinf(DEG2RAD*rotation);
+    }
+    instance->shape[2] = radius*scale;
+    instance->shape[3] = thickness*scale;
+    instance->arc[0] = DEG2RAD*startAngle;
+    instance->arc[1] = DEG2RAD*endAngle;
+    instance->arc[2] = (float)type;
+    instance->arc[3] = depth;
+    instance->color[0] = RLGL.State.colorr;
+    instance->color[1] = RLGL.State.colorg;
+    instance->color[2] = RLGL.State.colorb;
+    instance->color[3] = RLGL.State.colora;
+
+    RLGL.Shapes.count++;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].shapeCount++;
+
+    // Next shapes are drawn on top, same as vertex data (see rlEnd())
+    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+
+    return true;
+}
+
+// Load SDF shapes shader and buffers
+// NOTE: Every shape is a quad drawn with glDrawArraysInstanced(), its corners come from gl_VertexID
+// and its parameters from the instance buffer, coverage is computed in the fragment shader
+static bool rlLoadShapesSDF(void)
+{
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    const char *shapesVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision highp float;             \n"
+#else
+    "#version 330                       \n"
+#endif
+    "in vec4 instanceBounds;            \n"     // Center (XY), half size or radius (ZW)
+    "in vec4 instanceShape;             \n"     // Rotation cosine and sine, radius, thickness
+    "in vec4 instanceArc;               \n"     // Arc start and end angles, type, depth
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragPosition;             \n"
+    "flat out vec4 fragBounds;          \n"
+    "flat out vec4 fragShape;           \n"
+    "flat out vec4 fragEdges;           \n"
+    "flat out vec2 fragArc;             \n"
+    "out vec4 fragColor;                \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 corner = vec2(float(gl_VertexID/2), float(gl_VertexID%2))*2.0 - 1.0; \n"
+    "    fragPosition = corner*(instanceBounds.zw + 1.0); \n"   // One unit margin for anti-aliased edges
+    "    vec2 position = instanceBounds.xy + vec2(fragPosition.x*instanceShape.x - fragPosition.y*instanceShape.y, \n"
+    "        fragPosition.x*instanceShape.y + fragPosition.y*instanceShape.x); \n"
+    "    fragBounds = instanceBounds;   \n"
+    "    fragShape = instanceShape;     \n"
+    "    fragEdges = vec4(-sin(instanceArc.x), cos(instanceArc.x), -sin(instanceArc.y), cos(instanceArc.y)); \n"
+    "    fragArc = vec2(instanceArc.y - instanceArc.x, instanceArc.z); \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(position, instanceArc.w, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Distance is computed in shape units and converted to pixels with the position derivatives,
+    // arc sectors intersect (sweep up to 180 degrees) or join (larger sweeps) the half planes of their edges
+    const char *shapesFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision highp float;             \n"
+#else
+    "#version 330                       \n"
+#endif
+    "in vec2 fragPosition;              \n"
+    "flat in vec4 fragBounds;           \n"
+    "flat in vec4 fragShape;            \n"
+    "flat in vec4 fragEdges;            \n"
+    "flat in vec2 fragArc;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float dist = 0.0;              \n"
+    "    if (fragArc.y < 0.5)           \n"
+    "    {                              \n"
+    "        float len = length(fragPosition); \n"
+    "        dist = len - fragShape.z;  \n"
+    "        if (fragShape.w > 0.0) dist = max(dist, fragShape.z - fragShape.w - len); \n"
+    "        if (fragArc.x < 6.2831853) \n"
+    "        {                          \n"
+    "            float start = -dot(fragPosition, fragEdges.xy); \n"
+    "            float end = dot(fragPosition, fragEdges.zw); \n"
+    "            dist = max(dist, (fragArc.x <= 3.1415927)? max(start, end) : min(start, end)); \n"
+    "        }                          \n"
+    "    }                              \n"
+    "    else                           \n"
+    "    {                              \n"
+    "        vec2 q = abs(fragPosition) - fragBounds.zw + fragShape.z; \n"
+    "        dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "        if (fragShape.w > 0.0) dist = max(dist, -dist - fragShape.w); \n"
+    "    }                              \n"
+    "    float alpha = clamp(0.5 - dist/max(length(dFdx(fragPosition)), 0.0001), 0.0, 1.0); \n"
+    "    if (alpha <= 0.0) discard;     \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha); \n"
+    "}                                  \n";
+
+    if (RLGL.ExtSupported.vao && RLGL.ExtSupported.instancing)
+    {
+        unsigned int vShaderId = rlCompileShader(shapesVShaderCode, GL_VERTEX_SHADER);
+        unsigned int fShaderId = rlCompileShader(shapesFShaderCode, GL_FRAGMENT_SHADER);
+
+        if ((vShaderId != 0) && (fShaderId != 0)) RLGL.Shapes.shaderId = rlLoadShaderProgram(vShaderId, fShaderId);
+
+        if (vShaderId != 0)
+        {
+            if (RLGL.Shapes.shaderId > 0) glDetachShader(RLGL.Shapes.shaderId, vShaderId);
+            glDeleteShader(vShaderId);
+        }
+        if (fShaderId != 0)
+        {
+            if (RLGL.Shapes.shaderId > 0) glDetachShader(RLGL.Shapes.shaderId, fShaderId);
+            glDeleteShader(fShaderId);
+        }
+    }
+
+    if (RLGL.Shapes.shaderId > 0)
+    {
+        RLGL.Shapes.mvpLoc = glGetUniformLocation(RLGL.Shapes.shaderId, "mvp");
+        RLGL.Shapes.instances = (rlShapeInstance *)RL_MALLOC(RL_DEFAULT_BATCH_SHAPES*sizeof(rlShapeInstance));
+        RLGL.Shapes.count = 0;
+
+        glGenVertexArrays(1, &RLGL.Shapes.vaoId);
+        glBindVertexArray(RLGL.Shapes.vaoId);
+
+        glGenBuffers(1, &RLGL.Shapes.vboId);
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.Shapes.vboId);
+        glBufferData(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_SHAPES*sizeof(rlShapeInstance), NULL, GL_DYNAMIC_DRAW);
+
+        // Instance attributes: bounds, shape and arc (3 x vec4), color (4 x unsigned byte)
+        const char *attribNames[4] = { "instanceBounds", "instanceShape", "instanceArc", "instanceColor" };
+        for (int i = 0; i < 4; i++)
+        {
+            int location = glGetAttribLocation(RLGL.Shapes.shaderId, attribNames[i]);
+            RLGL.Shapes.attribLocs[i] = location;
+            if (location < 0) continue;
+
+            glEnableVertexAttribArray(location);
+            if (i < 3) glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(rlShapeInstance), (void *)(i*4*sizeof(float)));
+            else glVertexAttribPointer(location, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlShapeInstance), (void *)(12*sizeof(float)));
+            glVertexAttribDivisor(location, 1);
+        }
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF shapes shader loaded successfully", RLGL.Shapes.shaderId);
+        result = true;
+    }
+#endif
+
+    if (!result)
+    {
+        RLGL.Shapes.failed = true;
+        TRACELOG(RL_LOG_WARNING, "SHADER: SDF shapes not available (OpenGL 3.3 or ES3 required), shapes are tessellated");
+    }
+
+    return result;
+}
+
+// Unload SDF shapes shader and buffers
+static void rlUnloadShapesSDF(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (RLGL.Shapes.shaderId > 0)
+    {
+        glDeleteVertexArrays(1, &RLGL.Shapes.vaoId);
+        glDeleteBuffers(1, &RLGL.Shapes.vboId);
+        glDeleteProgram(RLGL.Shapes.shaderId);
+        RL_FREE(RLGL.Shapes.instances);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF shapes shader unloaded successfully", RLGL.Shapes.shaderId);
+    }
+#endif
+
+    RLGL.Shapes.instances = NULL;
+    RLGL.Shapes.count = 0;
+    RLGL.Shapes.shaderId = 0;
+    RLGL.Shapes.failed = false;
+}
+
+// Update SDF shapes instance buffer with instances waiting to be drawn
+static void rlUpdateShapesSDF(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    // NOTE: Buffer is orphaned before updating it, same as batch vertex buffers
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Shapes.vboId);
+    glBufferData(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_SHAPES*sizeof(rlShapeInstance), NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.Shapes.count*sizeof(rlShapeInstance), RLGL.Shapes.instances);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    RLGL.Stats.counters.bufferBytes += RLGL.Shapes.count*(int)sizeof(rlShapeInstance);
+#endif
+}
+
+// Draw a run of SDF shape instances, with current modelview and projection matrices
+// NOTE: There is no base instance in OpenGL 3.3 and ES3, instance attributes are pointed to the run first instance
+static void rlDrawShapesSDF(int offset, int count)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+
+    glUseProgram(RLGL.Shapes.shaderId);
+    glUniformMatrix4fv(RLGL.Shapes.mvpLoc, 1, false, matMVPfloat);
+
+    glBindVertexArray(RLGL.Shapes.vaoId);
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Shapes.vboId);
+
+    size_t first = offset*sizeof(rlShapeInstance);
+    for (int i = 0; i < 4; i++)
+    {
+        if (RLGL.Shapes.attribLocs[i] < 0) continue;
+
+        if (i < 3) glVertexAttribPointer(RLGL.Shapes.attribLocs[i], 4, GL_FLOAT, GL_FALSE, sizeof(rlShapeInstance), (void *)(first + i*4*sizeof(float)));
+        else glVertexAttribPointer(RLGL.Shapes.attribLocs[i], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlShapeInstance), (void *)(first + 12*sizeof(float)));
+    }
+
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += 4*count;
+#endif
+}
+
+// Define vertices from arrays, with the same transform and batch limits as rlVertex3f()
+// NOTE: Limits are checked once per run of vertices that fits in the current batch buffer,
+// runs end on whole primitives so the batch is only drawn between primitives
+static void rlVertexArray(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int count)
+{
+    while (count > 0)
+    {
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int primitive = (draw->mode == RL_LINES)? 2 : ((draw->mode == RL_TRIANGLES)? 3 : 4);
+        int space = buffer->elementCount*4 - RLGL.State.vertexCounter;
+        int run = count;
+
+        if (run > space)
+        {
+            run = space - (draw->vertexCount + space)%primitive;
+
+            if (run <= 0)
+            {
+                // No whole primitive fits anymore, draw the batch and continue on a new one
+                rlCheckRenderBatchLimit(count);
+                continue;
+            }
+        }
+
+        int first = RLGL.State.vertexCounter;
+
+        if (RLGL.currentBatch->layout == RL_BATCH_LAYOUT_COMPACT)
+        {
+            // Positions are transformed in blocks and interleaved with texcoords and colors
+            float positions[3*64] = { 0 };
+
+            for (int i = 0; i < run; i += 64)
+            {
+                int block = ((run - i) < 64)? (run - i) : 64;
+                rlTransformVertices(vertices + components*i, components, positions, block);
+
+                for (int j = 0; j < block; j++)
+                {
+                    rlBatchVertex *vertex = &buffer->packed[first + i + j];
+                    float u = (texcoords != NULL)? texcoords[2*(i + j)] : RLGL.State.texcoordx;
+                    float v = (texcoords != NULL)? texcoords[2*(i + j) + 1] : RLGL.State.texcoordy;
+                    u = (u < 0.0f)? 0.0f : ((u > 1.0f)? 1.0f : u);
+                    v = (v < 0.0f)? 0.0f : ((v > 1.0f)? 1.0f : v);
+
+                    vertex->x = positions[3*j];
+                    vertex->y = positions[3*j + 1];
+                    vertex->z = positions[3*j + 2];
+                    vertex->u = (unsigned short)(u*65535.0f + 0.5f);
+                    vertex->v = (unsigned short)(v*65535.0f + 0.5f);
+
+                    if (colors != NULL)
+                    {
+                        vertex->r = colors[4*(i + j)];
+                        vertex->g = colors[4*(i + j) + 1];
+                        vertex->b = colors[4*(i + j) + 2];
+                        vertex->a = colors[4*(i + j) + 3];
+                    }
+                    else
+                    {
+                        vertex->r = RLGL.State.colorr;
+                        vertex->g = RLGL.State.colorg;
+                        vertex->b = RLGL.State.colorb;
+                        vertex->a = RLGL.State.colora;
+                    }
+                }
+            }
+        }
+        else
+        {
+            rlTransformVertices(vertices, components, buffer->vertices + 3*first, run);
+
+            if (texcoords != NULL) memcpy(buffer->texcoords + 2*first, texcoords, run*2*sizeof(float));
+            else
+            {
+                for (int i = first; i < (first + run); i++)
+                {
+                    buffer->texcoords[2*i] = RLGL.State.texcoordx;
+                    buffer->texcoords[2*i + 1] = RLGL.State.texcoordy;
+                }
+            }
+
+            if (colors != NULL) memcpy(buffer->colors + 4*first, colors, run*4*sizeof(unsigned char));
+            else
+            {
+                unsigned char color[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+                for (int i = first; i < (first + run); i++) memcpy(buffer->colors + 4*i, color, 4);
+            }
+        }
+
+        RLGL.State.vertexCounter += run;
+        draw->vertexCount += run;
+
+        vertices += components*run;
+        if (texcoords != NULL) texcoords += 2*run;
+        if (colors != NULL) colors += 4*run;
+        count -= run;
+    }
+}
+
+// Transform vertex positions (2 or 3 float per vertex) to batch positions (3 float per vertex)
+// NOTE: 2 float positions get the current batch depth as Z, like rlVertex2f()
+static void rlTransformVertices(const float *vertices, int components, float *result, int count)
+{
+    float depth = RLGL.currentBatch->currentDepth;
+    int i = 0;
+
+    if (!RLGL.State.transformRequired)
+    {
+        if (components == 3) memcpy(result, vertices, count*3*sizeof(float));
+        else
+        {
+            for (i = 0; i < count; i++)
+            {
+                result[3*i] = vertices[2*i];
+                result[3*i + 1] = vertices[2*i + 1];
+                result[3*i + 2] = depth;
+            }
+        }
+        return;
+    }
+
+    Matrix mat = RLGL.State.transform;
+
+#if defined(RLGL_SIMD_SSE)
+    // Four vertices at a time: deinterleave to X, Y, Z vectors, transform, interleave back
+    #define RL_SHUFFLE(p, q, i0, i1, i2, i3) _mm_shuffle_ps(p, q, _MM_SHUFFLE(i3, i2, i1, i0))
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+
+        if (components == 3)
+        {
+            __m128 a = _mm_loadu_ps(vertices + 3*i);        // x0 y0 z0 x1
+            __m128 b = _mm_loadu_ps(vertices + 3*i + 4);    // y1 z1 x2 y2
+            __m128 c = _mm_loadu_ps(vertices + 3*i + 8);    // z2 x3 y3 z3
+
+            x = RL_SHUFFLE(a, RL_SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+            y = RL_SHUFFLE(RL_SHUFFLE(a, b, 1, 1, 0, 0), RL_SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+            z = RL_SHUFFLE(RL_SHUFFLE(a, b, 2, 2, 1, 1), RL_SHUFFLE(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+        }
+        else
+        {
+            __m128 a = _mm_loadu_ps(vertices + 2*i);        // x0 y0 x1 y1
+            __m128 b = _mm_loadu_ps(vertices + 2*i + 4);    // x2 y2 x3 y3
+
+            x = RL_SHUFFLE(a, b, 0, 2, 0, 2);
+            y = RL_SHUFFLE(a, b, 1, 3, 1, 3);
+            z = _mm_set1_ps(depth);
+        }
+
+        __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m0)), _mm_mul_ps(y, _mm_set1_ps(mat.m4))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m8)), _mm_set1_ps(mat.m12)));
+        __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m1)), _mm_mul_ps(y, _mm_set1_ps(mat.m5))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m9)), _mm_set1_ps(mat.m13)));
+        __m128 tz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m2)), _mm_mul_ps(y, _mm_set1_ps(mat.m6))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m10)), _mm_set1_ps(mat.m14)));
+
+        _mm_storeu_ps(result + 3*i, RL_SHUFFLE(RL_SHUFFLE(tx, ty, 0, 0, 0, 0), RL_SHUFFLE(tz, tx, 0, 0, 1, 1), 0, 2, 0, 2));
+        _mm_storeu_ps(result + 3*i + 4, RL_SHUFFLE(RL_SHUFFLE(ty, tz, 1, 1, 1, 1), RL_SHUFFLE(tx, ty, 2, 2, 2, 2), 0, 2, 0, 2));
+        _mm_storeu_ps(result + 3*i + 8, RL_SHUFFLE(RL_SHUFFLE(tz, tx, 2, 2, 3, 3), RL_SHUFFLE(ty, tz, 3, 3, 3, 3), 0, 2, 0, 2));
+    }
+    #undef RL_SHUFFLE
+#elif defined(RLGL_SIMD_NEON)
+    // Four vertices at a time, NEON structure loads/stores do the (de)interleaving
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t x, y, z;
+
+        if (components == 3)
+        {
+            float32x4x3_t v = vld3q_f32(vertices + 3*i);
+            x = v.val[0];
+            y = v.val[1];
+            z = v.val[2];
+        }
+        else
+        {
+            float32x4x2_t v = vld2q_f32(vertices + 2*i);
+            x = v.val[0];
+            y = v.val[1];
+            z = vdupq_n_f32(depth);
+        }
+
+        float32x4x3_t t;
+        t.val[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m12), x, mat.m0), y, mat.m4), z, mat.m8);
+        t.val[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m13), x, mat.m1), y, mat.m5), z, mat.m9);
+        t.val[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m14), x, mat.m2), y, mat.m6), z, mat.m10);
+        vst3q_f32(result + 3*i, t);
+    }
+#endif
+
+    // Remaining vertices (or all of them without SIMD support)
+    for (; i < count; i++)
+    {
+        float x = vertices[components*i];
+        float y = vertices[components*i + 1];
+        float z = (components == 3)? vertices[components*i + 2] : depth;
+
+        result[3*i] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[3*i + 1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[3*i + 2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Move recorder batch content into the recorded arrays and reset the batch, as rlDrawRenderBatch() does
+// NOTE: Alignment vertex are dropped, consecutive draw calls with same mode, texture and layer are merged
+static void rlRecordRenderBatch(rlRenderBatch *batch)
+{
+    rlRecorder *recorder = RLGL.recorder;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[0];
+
+    if (RLGL.State.vertexCounter > 0)
+    {
+        // Grow recorded arrays if required
+        if (recorder->vertexCount + RLGL.State.vertexCounter > recorder->vertexCapacity)
+        {
+            int capacity = (recorder->vertexCapacity > 0)? recorder->vertexCapacity : 4096;
+            while (capacity < recorder->vertexCount + RLGL.State.vertexCounter) capacity *= 2;
+
+            recorder->vertices = (float *)RL_REALLOC(recorder->vertices, capacity*3*sizeof(float));
+            recorder->texcoords = (float *)RL_REALLOC(recorder->texcoords, capacity*2*sizeof(float));
+            recorder->colors = (unsigned char *)RL_REALLOC(recorder->colors, capacity*4*sizeof(unsigned char));
+            recorder->vertexCapacity = capacity;
+        }
+
+        if (recorder->drawCount + batch->drawCounter > recorder->drawCapacity)
+        {
+            int capacity = (recorder->drawCapacity > 0)? recorder->drawCapacity : 64;
+            while (capacity < recorder->drawCount + batch->drawCounter) capacity *= 2;
+
+            recorder->draws = (rlDrawCall *)RL_REALLOC(recorder->draws, capacity*sizeof(rlDrawCall));
+            recorder->drawCapacity = capacity;
+        }
+
+        for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+        {
+            rlDrawCall *draw = &batch->draws[i];
+
+            if (draw->vertexCount > 0)
+            {
+                rlDrawCall *last = (recorder->drawCount > 0)? &recorder->draws[recorder->drawCount - 1] : NULL;
+
+                if ((last != NULL) && (last->mode == draw->mode) && (last->textureId == draw->textureId) && (last->layer == draw->layer)) last->vertexCount += draw->vertexCount;
+                else
+                {
+                    recorder->draws[recorder->drawCount] = *draw;
+                    recorder->draws[recorder->drawCount].vertexAlignment = 0;
+                    recorder->drawCount++;
+                }
+
+                memcpy(recorder->vertices + 3*recorder->vertexCount, buffer->vertices + 3*vertexOffset, draw->vertexCount*3*sizeof(float));
+                memcpy(recorder->texcoords + 2*recorder->vertexCount, buffer->texcoords + 2*vertexOffset, draw->vertexCount*2*sizeof(float));
+                memcpy(recorder->colors + 4*recorder->vertexCount, buffer->colors + 4*vertexOffset, draw->vertexCount*4*sizeof(unsigned char));
+                recorder->vertexCount += draw->vertexCount;
+            }
+
+            vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+        }
+    }
+
+    // Reset batch as a draw would
+    RLGL.State.vertexCounter = 0;
+    batch->currentDepth = -1.0f;
+
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
+        batch->draws[i].shapeCount = 0;
+    }
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
+
+    batch->drawCounter = 1;
+}
+
+// Sort and merge the first drawCount draw calls of a render batch
+// NOTE: Draw calls after drawCount are kept after the merged ones, they must not have vertex data yet
+// NOTE: Draw calls are ordered by layer (keeping submission order within a layer) and each one joins
+// the latest previous draw call with same layer, mode and texture, unless it overlaps a draw call
+// drawn in between; vertex data is moved in place so merged draw calls are contiguous.
+// Overlaps are checked on the XY bounds of the vertex, that only matches what ends up on screen
+// when the batch projection is 2d (orthographic and not depending on Z), otherwise draw calls
+// are just ordered by layer, only merging when they are next to each other.
+// Triangles only sharing a bounds edge never shade the same pixel, lines bounds are grown by
+// the line width (plus one pixel for smoothing) converted to batch units.
+// WARNING: Persistent mapped buffers are read back, which can be slow depending on the driver
+static void rlSortRenderBatch(rlRenderBatch *batch, int drawCount)
+{
+    typedef struct {
+        int start;              // First vertex of the draw call, before sorting
+        int target;             // First vertex of the draw call, after sorting
+        int group;              // Merged draw call it goes to (-1 for empty draw calls)
+        float bounds[4];        // Vertex XY bounds: min x, min y, max x, max y
+    } rlSortItem;
+
+    typedef struct {
+        rlDrawCall draw;        // Merged draw call
+        int start;              // First vertex of the merged draw call, after sorting
+        int filled;             // Vertex already moved into it
+        float bounds[4];        // Vertex XY bounds of all merged draw calls
+    } rlSortGroup;
+
+    rlDrawCall *draws = batch->draws;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    bool compact = (batch->layout == RL_BATCH_LAYOUT_COMPACT);
+
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    bool planar = !RLGL.State.stereoRender && (matMVP.m8 == 0.0f) && (matMVP.m9 == 0.0f) &&
+        (matMVP.m3 == 0.0f) && (matMVP.m7 == 0.0f) && (matMVP.m11 == 0.0f);
+
+    // Lines cover pixels around them, up to half the line width, measured in batch units
+    float lineMargin[2] = { 0 };
+    for (int i = 0; planar && (i < drawCount); i++)
+    {
+        if ((draws[i].mode == RL_LINES) && (draws[i].vertexCount > 0))
+        {
+            int viewport[4] = { 0 };
+            float lineWidth = 1.0f;
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glGetFloatv(GL_LINE_WIDTH, &lineWidth);
+
+            // Inverse of the batch to pixels transform, its rows bound the batch offset of a pixel offset
+            float sx = 0.5f*viewport[2];
+            float sy = 0.5f*viewport[3];
+            float det = (matMVP.m0*matMVP.m5 - matMVP.m4*matMVP.m1)*sx*sy;
+            float pixels = 0.5f*lineWidth + 1.0f;
+
+            if (det == 0.0f) planar = false;
+            else
+            {
+                lineMargin[0] = pixels*(fabsf(matMVP.m5)*sy + fabsf(matMVP.m4)*sx)/fabsf(det);
+                lineMargin[1] = pixels*(fabsf(matMVP.m1)*sy + fabsf(matMVP.m0)*sx)/fabsf(det);
+            }
+            break;
+        }
+    }
+
+    rlSortItem *items = (rlSortItem *)RL_MALLOC(drawCount*sizeof(rlSortItem));
+    rlSortGroup *groups = (rlSortGroup *)RL_MALLOC(drawCount*sizeof(rlSortGroup));
+    int *order = (int *)RL_MALLOC(drawCount*sizeof(int));
+
+    // Locate draw calls vertex data and measure their bounds
+    for (int i = 0, start = 0; i < drawCount; i++)
+    {
+        items[i].start = start;
+        for (int k = 0; k < 4; k++) items[i].bounds[k] = 0.0f;
+
+        for (int v = start; planar && (v < start + draws[i].vertexCount); v++)
+        {
+            float x = compact? buffer->packed[v].x : buffer->vertices[3*v];
+            float y = compact? buffer->packed[v].y : buffer->vertices[3*v + 1];
+
+            if ((v == start) || (x < items[i].bounds[0])) items[i].bounds[0] = x;
+            if ((v == start) || (y < items[i].bounds[1])) items[i].bounds[1] = y;
+            if ((v == start) || (x > items[i].bounds[2])) items[i].bounds[2] = x;
+            if ((v == start) || (y > items[i].bounds[3])) items[i].bounds[3] = y;
+        }
+
+        if (draws[i].mode == RL_LINES)
+        {
+            items[i].bounds[0] -= lineMargin[0];
+            items[i].bounds[1] -= lineMargin[1];
+            items[i].bounds[2] += lineMargin[0];
+            items[i].bounds[3] += lineMargin[1];
+        }
+
+        start += draws[i].vertexCount + draws[i].vertexAlignment;
+    }
+
+    // Order by layer, insertion sort keeps submission order for equal layers
+    for (int i = 0; i < drawCount; i++)
+    {
+        int n = i;
+        for (; (n > 0) && (draws[order[n - 1]].layer > draws[i].layer); n--) order[n] = order[n - 1];
+        order[n] = i;
+    }
+
+    // Group draw calls
+    int groupCount = 0;
+    int itemCount = 0;
+    bool reordered = false;
+
+    for (int n = 0; n < drawCount; n++)
+    {
+        int i = order[n];
+        items[i].group = -1;
+
+        if (draws[i].vertexCount == 0) continue;
+        if (i != n) reordered = true;
+        itemCount++;
+
+        // Look back for a draw call to join, until one it overlaps
+        int target = -1;
+        for (int g = groupCount - 1; g >= 0; g--)
+        {
+            if (groups[g].draw.layer != draws[i].layer) break;
+            if ((groups[g].draw.mode == draws[i].mode) && (groups[g].draw.textureId == draws[i].textureId))
+            {
+                target = g;
+                break;
+            }
+            if (!planar ||
+                ((items[i].bounds[0] < groups[g].bounds[2]) && (items[i].bounds[2] > groups[g].bounds[0]) &&
+                 (items[i].bounds[1] < groups[g].bounds[3]) && (items[i].bounds[3] > groups[g].bounds[1]))) break;
+        }
+
+        if (target == -1)
+        {
+            target = groupCount;
+            groupCount++;
+
+            groups[target].draw = draws[i];
+            groups[target].draw.vertexCount = 0;
+            groups[target].draw.shapeCount = 0;
+            groups[target].filled = 0;
+            for (int k = 0; k < 4; k++) groups[target].bounds[k] = items[i].bounds[k];
+        }
+        else if (planar)
+        {
+            if (items[i].bounds[0] < groups[target].bounds[0]) groups[target].bounds[0] = items[i].bounds[0];
+            if (items[i].bounds[1] < groups[target].bounds[1]) groups[target].bounds[1] = items[i].bounds[1];
+            if (items[i].bounds[2] > groups[target].bounds[2]) groups[target].bounds[2] = items[i].bounds[2];
+            if (items[i].bounds[3] > groups[target].bounds[3]) groups[target].bounds[3] = items[i].bounds[3];
+        }
+
+        groups[target].draw.vertexCount += draws[i].vertexCount;
+        items[i].group = target;
+    }
+
+    if (reordered || (groupCount < itemCount))
+    {
+        int keptCount = batch->drawCounter - drawCount;
+        int vertexCount = 0;
+
+        // Place merged draw calls, the last one only needs alignment if more draw calls follow
+        for (int g = 0; g < groupCount; g++)
+        {
+            rlDrawCall *draw = &groups[g].draw;
+
+            if ((g == groupCount - 1) && (keptCount == 0)) draw->vertexAlignment = 0;
+            else if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            groups[g].start = vertexCount;
+            vertexCount += draw->vertexCount + draw->vertexAlignment;
+        }
+
+        // Move vertex data, attribute by attribute, through a scratch buffer
+        // NOTE: Merged draw calls never need more vertex than the original ones (alignment included)
+        unsigned char *scratch = (unsigned char *)RL_MALLOC(RLGL.State.vertexCounter*sizeof(rlBatchVertex));
+        unsigned char *arrays[3] = { (unsigned char *)buffer->vertices, (unsigned char *)buffer->texcoords, buffer->colors };
+        int sizes[3] = { 3*sizeof(float), 2*sizeof(float), 4*sizeof(unsigned char) };
+        int arrayCount = 3;
+
+        if (compact)
+        {
+            arrays[0] = (unsigned char *)buffer->packed;
+            sizes[0] = sizeof(rlBatchVertex);
+            arrayCount = 1;
+        }
+
+        for (int n = 0; n < drawCount; n++)
+        {
+            int i = order[n];
+            if (items[i].group < 0) continue;
+
+            rlSortGroup *group = &groups[items[i].group];
+            items[i].target = group->start + group->filled;
+            group->filled += draws[i].vertexCount;
+        }
+
+        for (int a = 0; a < arrayCount; a++)
+        {
+            int size = sizes[a];
+
+            for (int i = 0; i < drawCount; i++)
+            {
+                if (items[i].group >= 0) memcpy(scratch + items[i].target*size, arrays[a] + items[i].start*size, draws[i].vertexCount*size);
+            }
+
+            memcpy(arrays[a], scratch, vertexCount*size);
+        }
+
+        RL_FREE(scratch);
+
+        // Replace sorted draw calls by the merged ones, moving the kept ones after them
+        // NOTE: With draw sorting SDF shapes are only added before any vertex data, they stay in the first draw call
+        int shapeCount = draws[0].shapeCount;
+        for (int g = 0; g < groupCount; g++) draws[g] = groups[g].draw;
+        for (int k = 0; k < keptCount; k++) draws[groupCount + k] = draws[drawCount + k];
+
+        for (int i = groupCount + keptCount; i < batch->drawCounter; i++)
+        {
+            draws[i].mode = RL_QUADS;
+            draws[i].vertexCount = 0;
+            draws[i].textureId = RLGL.State.defaultTextureId;
+            draws[i].layer = RLGL.State.drawLayer;
+            draws[i].shapeCount = 0;
+        }
+
+        batch->drawCounter = groupCount + keptCount;
+        if (batch->drawCounter == 0) batch->drawCounter = 1;
+        draws[0].shapeCount = shapeCount;
+        RLGL.State.vertexCounter = vertexCount;
+    }
+
+    RL_FREE(items);
+    RL_FREE(groups);
+    RL_FREE(order);
+}
+
+// Allocate immutable storage for the buffer bound to GL_ARRAY_BUFFER and keep it mapped
+// NOTE: Coherent mapping makes CPU writes visible to the next draw calls without flushing,
+// the buffer must not be written while the GPU could still be reading it (see rlWaitBatchBuffer())
+static void *rlMapBatchBuffer(int size)
+{
+    void *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+    data = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+#endif
+
+    return data;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Wait for the draws issued from a persistent mapped vertex buffer to complete
+static void rlWaitBatchBuffer(rlVertexBuffer *buffer)
+{
+    if (buffer->fence != NULL)
+    {
+        // NOTE: First wait also flushes pending commands, so the fence is guaranteed to signal
+        GLenum result = glClientWaitSync((GLsync)buffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)buffer->fence, 0, 1000000);   // 1 ms timeout
+
+        if (result == GL_WAIT_FAILED) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to wait for render batch buffer fence");
+
+        glDeleteSync((GLsync)buffer->fence);
+        buffer->fence = NULL;
+    }
+}
+#endif
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
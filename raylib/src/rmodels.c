@@ -55,8 +55,9 @@
 
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), free()
-#include <string.h>         // Required for: memcmp(), strlen()
-#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <string.h>         // Required for: memcmp(), memcpy(), strlen()
+#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf(), fminf(), fmaxf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -119,10 +120,16 @@
     #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
     #define CHDIR _chdir
 #else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
+    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()], sysconf()
     #define CHDIR chdir
 #endif
 
+// Models worker threads require POSIX threads, jobs run on the calling thread otherwise
+#if defined(SUPPORT_MODELS_THREADS) && !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    #define MODELS_THREADS_AVAILABLE
+    #include <pthread.h>    // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -130,18 +137,97 @@
     #define MAX_MATERIAL_MAPS       12    // Maximum number of maps supported
 #endif
 #ifndef MAX_MESH_VERTEX_BUFFERS
-    #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
+    #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MAX_MODELS_THREADS
+    #define MAX_MODELS_THREADS       8    // Maximum threads working on models jobs (calling thread included)
+#endif
+
+#define MESH_BVH_BINS               16    // Bins per axis evaluated to split mesh BVH nodes (surface area heuristic)
+#define MESH_BVH_MAX_LEAF_TRIANGLES  8    // Maximum triangles per mesh BVH leaf, smaller leaves are used when cheaper
+#define MESH_BVH_MAX_DEPTH          64    // Maximum mesh BVH depth, deeper nodes are kept as leaves
+#define MESH_BVH_PARALLEL_TRIANGLES 65536 // Minimum triangles to build mesh BVH subtrees on worker threads
+#define MESH_RAYS_PER_JOB_ITEM      64    // Rays tested by every worker job item on rays batches
+#define MESH_SKIN_VERTICES_PER_JOB_ITEM 4096    // Vertices skinned by every worker job item on animations update
+#define MESH_SKIN_BONE_FLOATS       24    // Skinning palette floats per bone: position matrix (3x4) and normal matrix (3x3 padded to 3x4)
+#define MESH_SKIN_MAX_BONES        256    // Skinning palette bones, vertex bone ids are unsigned char
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh BVH node, the children of internal nodes are the next node and the node at start index
+typedef struct MeshBVHNode {
+    float min[3];               // Node bounds minimum
+    int start;                  // First triangle (leaf) or second child node index (internal node)
+    float max[3];               // Node bounds maximum
+    int count;                  // Triangles count (leaf) or 0 (internal node)
+} MeshBVHNode;
+
+// Mesh bounding volume hierarchy, nodes in depth-first order and triangles in leaves order
+struct MeshBVH {
+    MeshBVHNode *nodes;         // Nodes, root first
+    int nodeCount;              // Nodes count
+    float *triangles;           // Triangles first vertex and two edges (9 floats per triangle)
+    int triangleCount;          // Triangles count
+};
+
+// Mesh BVH node to be built: triangles range and node slot
+typedef struct MeshBVHTask {
+    int slot;                   // Node slot, subtree nodes use slots [slot, slot + 2*count - 1)
+    int first;                  // First triangle in build order
+    int count;                  // Triangles count
+    int depth;                  // Node depth
+} MeshBVHTask;
+
+// Mesh BVH build data, shared by the threads building subtrees
+typedef struct MeshBVHBuild {
+    float *bounds;              // Triangles bounds in build order (min and max XYZ, 6 floats per triangle)
+    int *order;                 // Triangles build order, leaves reference ranges of it
+    MeshBVHNode *nodes;         // Nodes slots, 2*triangles - 1 (compacted once built)
+    MeshBVHTask *tasks;         // Subtrees to be built, one per job item
+} MeshBVHBuild;
+
+// Mesh BVH bin, triangles with centroids in one slice of a node along one axis
+typedef struct MeshBVHBin {
+    float min[3];               // Triangles bounds minimum
+    float max[3];               // Triangles bounds maximum
+    int count;                  // Triangles count
+} MeshBVHBin;
+
+// Mesh ray collision query, rays are tested in model space
+typedef struct MeshRayQuery {
+    const Mesh *mesh;           // Mesh to be tested
+    Matrix invTransform;        // Mesh transform inverse, moves rays to model space
+    float normalSign;           // Collision normals sign, negative for mirroring transforms
+    const Ray *rays;            // Rays batch
+    RayCollision *collisions;   // Rays batch collisions
+    int count;                  // Rays batch count
+} MeshRayQuery;
+
+// Mesh skinning job, vertices are split in ranges between job items
+typedef struct MeshSkinJob {
+    const Mesh *mesh;           // Mesh to be skinned
+    const float *palette;       // Bones matrices rows, MESH_SKIN_BONE_FLOATS per bone
+} MeshSkinJob;
+
+#if defined(MODELS_THREADS_AVAILABLE)
+// Models worker threads, started with the first job that can use them
+typedef struct ModelsThreads {
+    pthread_t threads[MAX_MODELS_THREADS];
+    int threadCount;                            // Worker threads started (-1 if they could not be started)
+    void (*job)(void *data, int item);          // Job running
+    void *data;                                 // Job data
+    int itemCount;                              // Job items count
+    int nextItem;                               // Next job item to run
+    int workersRunning;                         // Workers still running the job
+    unsigned int jobCounter;                    // Jobs started, workers wait for it to change
+} ModelsThreads;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static int modelSkinningMode = MODEL_SKINNING_CPU;      // Model skinning mode (ModelSkinningMode)
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -168,6 +254,16 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
 
+static int GetModelsThreadCount(void);          // Get number of threads working on models jobs (calling thread included)
+static void RunModelsJob(void (*job)(void *data, int item), void *data, int itemCount);  // Run job items, on worker threads if available
+static void UnloadMeshBVH(MeshBVH *bvh);        // Unload mesh BVH data
+static int SplitMeshBVHNode(MeshBVHBuild *build, MeshBVHTask task);  // Compute mesh BVH node, returns left child triangles count (0 for leaves)
+static void BuildMeshBVHSubtree(void *data, int item);  // Build mesh BVH subtree (job item)
+static RayCollision GetRayCollisionMeshQuery(const MeshRayQuery *query, Ray ray);  // Get collision info between ray and query mesh
+static void GetRayCollisionMeshJob(void *data, int item);   // Get collision info between rays and query mesh (job item)
+static void SkinMeshVertices(void *data, int item);         // Skin mesh vertices range (job item)
+static bool IsMeshSkinnableGPU(const Mesh *mesh, int boneCount, Shader shader);  // Check if mesh can be skinned on GPU when drawn with shader
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -426,30 +522,42 @@ void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
+            // NOTE: Vertices are gathered for up to 32 slices and submitted at once
+            float vertices[6*3*32] = { 0 };
+
             for (int i = 0; i < (rings + 2); i++)
             {
+                float ringRadius = cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i));
+                float ringY = sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i));
+                float nextRingRadius = cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)));
+                float nextRingY = sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)));
+                int count = 0;
+
                 for (int j = 0; j < slices; j++)
                 {
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*j/slices)));
-
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
+                    float sinSlice = sinf(DEG2RAD*(360.0f*j/slices));
+                    float cosSlice = cosf(DEG2RAD*(360.0f*j/slices));
+                    float sinNextSlice = sinf(DEG2RAD*(360.0f*(j + 1)/slices));
+                    float cosNextSlice = cosf(DEG2RAD*(360.0f*(j + 1)/slices));
+                    float *v = vertices + 18*count;
+
+                    v[0] = ringRadius*sinSlice; v[1] = ringY; v[2] = ringRadius*cosSlice;
+                    v[3] = nextRingRadius*sinNextSlice; v[4] = nextRingY; v[5] = nextRingRadius*cosNextSlice;
+                    v[6] = nextRingRadius*sinSlice; v[7] = nextRingY; v[8] = nextRingRadius*cosSlice;
+
+                    v[9] = ringRadius*sinSlice; v[10] = ringY; v[11] = ringRadius*cosSlice;
+                    v[12] = ringRadius*sinNextSlice; v[13] = ringY; v[14] = ringRadius*cosNextSlice;
+                    v[15] = nextRingRadius*sinNextSlice; v[16] = nextRingY; v[17] = nextRingRadius*cosNextSlice;
+
+                    count++;
+                    if (count == 32)
+                    {
+                        rlVertexArray3f(vertices, 6*count);
+                        count = 0;
+                    }
                 }
+
+                rlVertexArray3f(vertices, 6*count);
             }
         rlEnd();
     rlPopMatrix();
@@ -1190,6 +1298,8 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     mesh->vboId[4] = 0;     // Vertex buffer: tangents
     mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
     mesh->vboId[6] = 0;     // Vertex buffer: indices
+    mesh->vboId[7] = 0;     // Vertex buffer: bone ids
+    mesh->vboId[8] = 0;     // Vertex buffer: bone weights
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     mesh->vaoId = rlLoadVertexArray();
@@ -1281,6 +1391,23 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
     }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // NOTE: Bones data is only used by the skinning shader (MODEL_SKINNING_GPU), it never changes
+    // so animated poses only require the bone matrices uniform, no vertex buffer update
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        // Enable vertex attribute: bone ids (shader-location = 7)
+        mesh->vboId[7] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), false);
+        rlSetVertexAttribute(7, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(7);
+
+        // Enable vertex attribute: bone weights (shader-location = 8)
+        mesh->vboId[8] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), false);
+        rlSetVertexAttribute(8, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(8);
+    }
+#endif
+
     if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
     else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
 
@@ -1330,6 +1457,15 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Animated meshes drawn with default shader use default skinning shader (MODEL_SKINNING_GPU)
+    // NOTE: Material is a copy, user material shader is not modified
+    bool skinning = (mesh.skinningMode == MODEL_SKINNING_GPU) && (mesh.boneMatrices != NULL) && IsMeshSkinnableGPU(&mesh, mesh.boneCount, material.shader);
+    if (skinning && (material.shader.id == rlGetShaderIdDefault()))
+    {
+        material.shader.id = rlGetShaderIdDefaultSkinning();
+        material.shader.locs = rlGetShaderLocsDefaultSkinning();
+    }
+
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1388,6 +1524,9 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+    // Upload bones skinning matrices (if skinning on GPU and location available)
+    if (skinning && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1)) rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
@@ -1467,6 +1606,18 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
+        // Bind mesh VBO data: vertex bone ids and weights (shader-location = 7 and 8, if skinning)
+        if (skinning && (material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+
         if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
 
@@ -1534,6 +1685,9 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     float16 *instanceTransforms = NULL;
     unsigned int instancesVboId = 0;
 
+    // Bones skinning matrices are sent to instancing shader if it provides them (MODEL_SKINNING_GPU)
+    bool skinning = (mesh.skinningMode == MODEL_SKINNING_GPU) && (mesh.boneMatrices != NULL) && IsMeshSkinnableGPU(&mesh, mesh.boneCount, material.shader);
+
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1611,6 +1765,9 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+    // Upload bones skinning matrices (if skinning on GPU and location available)
+    if (skinning && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1)) rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
@@ -1688,6 +1845,18 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
+        // Bind mesh VBO data: vertex bone ids and weights (shader-location = 7 and 8, if skinning)
+        if (skinning && (material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+
         if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
 
@@ -1768,6 +1937,9 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.animNormals);
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+
+    UnloadMeshBVH(mesh.bvh);
 }
 
 // Export mesh data to file
@@ -1992,105 +2164,121 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
     return animations;
 }
 
+// Set model skinning mode (ModelSkinningMode)
+// NOTE: Mode is applied per mesh on its next UpdateModelAnimation(), until then meshes are drawn as last updated
+void SetModelSkinningMode(int mode)
+{
+    modelSkinningMode = mode;
+}
+
+// Get model skinning mode (ModelSkinningMode)
+int GetModelSkinningMode(void)
+{
+    return modelSkinningMode;
+}
+
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Bones skinning matrices are computed once per frame and vertices skinned on models worker threads,
+// meshes whose bones did not change since their last update are not skinned or uploaded again
+// NOTE: In MODEL_SKINNING_GPU mode only bones skinning matrices are updated, DrawMesh() sends them to the skinning shader
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
+        int boneCount = (model.boneCount < anim.boneCount)? model.boneCount : anim.boneCount;
+        if (boneCount > MESH_SKIN_MAX_BONES) boneCount = MESH_SKIN_MAX_BONES;
+
+        // Compute bones skinning matrices, moving vertices from bind pose to animated pose:
+        // v' = outRotation*inRotation^-1*((v - inTranslation)*outScale) + outTranslation
+        // NOTE: Palette stores matrices rows for the skinning kernel, missing bones are left zero
+        Matrix *boneMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+        float *palette = (float *)RL_CALLOC(MESH_SKIN_MAX_BONES*MESH_SKIN_BONE_FLOATS, sizeof(float));
+
+        for (int i = 0; i < boneCount; i++)
+        {
+            Vector3 inTranslation = model.bindPose[i].translation;
+            Quaternion inRotation = model.bindPose[i].rotation;
+            Vector3 outTranslation = anim.framePoses[frame][i].translation;
+            Quaternion outRotation = anim.framePoses[frame][i].rotation;
+            Vector3 outScale = anim.framePoses[frame][i].scale;
+
+            Matrix rotation = QuaternionToMatrix(QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+            Matrix bone = rotation;
+
+            bone.m0 *= outScale.x; bone.m1 *= outScale.x; bone.m2 *= outScale.x;
+            bone.m4 *= outScale.y; bone.m5 *= outScale.y; bone.m6 *= outScale.y;
+            bone.m8 *= outScale.z; bone.m9 *= outScale.z; bone.m10 *= outScale.z;
+            bone.m12 = outTranslation.x - (bone.m0*inTranslation.x + bone.m4*inTranslation.y + bone.m8*inTranslation.z);
+            bone.m13 = outTranslation.y - (bone.m1*inTranslation.x + bone.m5*inTranslation.y + bone.m9*inTranslation.z);
+            bone.m14 = outTranslation.z - (bone.m2*inTranslation.x + bone.m6*inTranslation.y + bone.m10*inTranslation.z);
+            boneMatrices[i] = bone;
+
+            float *rows = &palette[i*MESH_SKIN_BONE_FLOATS];
+            rows[0] = bone.m0; rows[1] = bone.m4; rows[2] = bone.m8; rows[3] = bone.m12;
+            rows[4] = bone.m1; rows[5] = bone.m5; rows[6] = bone.m9; rows[7] = bone.m13;
+            rows[8] = bone.m2; rows[9] = bone.m6; rows[10] = bone.m10; rows[11] = bone.m14;
+
+            // Normals are only rotated
+            rows[12] = rotation.m0; rows[13] = rotation.m4; rows[14] = rotation.m8;
+            rows[16] = rotation.m1; rows[17] = rotation.m5; rows[18] = rotation.m9;
+            rows[20] = rotation.m2; rows[21] = rotation.m6; rows[22] = rotation.m10;
+        }
+
         for (int m = 0; m < model.meshCount; m++)
         {
-            Mesh mesh = model.meshes[m];
+            Mesh *mesh = &model.meshes[m];
 
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+            if (mesh->boneIds == NULL || mesh->boneWeights == NULL)
             {
                 TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Mesh %i has no connection to bones", m);
                 continue;
             }
 
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+            // Meshes are skinned on GPU if their material shader can do it, otherwise on CPU
+            Shader shader = model.materials[model.meshMaterial[m]].shader;
+            int skinningMode = MODEL_SKINNING_CPU;
+            if ((modelSkinningMode == MODEL_SKINNING_GPU) && IsMeshSkinnableGPU(mesh, boneCount, shader)) skinningMode = MODEL_SKINNING_GPU;
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
+            // Skip mesh if bones did not change since last update in the same skinning mode
+            if ((mesh->skinningMode == skinningMode) && (mesh->boneMatrices != NULL) && (mesh->boneCount == boneCount) &&
+                (memcmp(mesh->boneMatrices, boneMatrices, boneCount*sizeof(Matrix)) == 0)) continue;
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+            if (mesh->boneCount != boneCount)
+            {
+                RL_FREE(mesh->boneMatrices);
+                mesh->boneMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+                mesh->boneCount = boneCount;
+            }
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+            memcpy(mesh->boneMatrices, boneMatrices, boneCount*sizeof(Matrix));
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+            if (skinningMode == MODEL_SKINNING_GPU)
             {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
-
-                if (mesh.animNormals != NULL)
+                // Vertex buffers still hold CPU skinned data, restore bind pose for skinning shader
+                if (mesh->skinningMode != MODEL_SKINNING_GPU)
                 {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
+                    rlUpdateVertexBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+                    if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
+                    mesh->skinningMode = MODEL_SKINNING_GPU;
                 }
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
+                continue;
             }
 
+            mesh->skinningMode = MODEL_SKINNING_CPU;
+
+            MeshSkinJob job = { mesh, palette };
+            RunModelsJob(SkinMeshVertices, &job, (mesh->vertexCount + MESH_SKIN_VERTICES_PER_JOB_ITEM - 1)/MESH_SKIN_VERTICES_PER_JOB_ITEM);
+
             // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
-            {
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-            }
+            rlUpdateVertexBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float), 0); // Update vertex position
+            if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float), 0);  // Update vertex normals
         }
+
+        RL_FREE(boneMatrices);
+        RL_FREE(palette);
     }
 }
 
@@ -3408,6 +3596,136 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Generate mesh bounding volume hierarchy, used by GetRayCollisionMesh() to skip most triangles
+// NOTE: Triangles are copied into the hierarchy, it must be generated again if mesh vertices change
+void GenMeshBVH(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: BVH generation requires vertex position data");
+        return;
+    }
+
+    if (mesh->bvh != NULL) UnloadMeshBVH(mesh->bvh);
+    mesh->bvh = NULL;
+
+    int triangleCount = mesh->triangleCount;
+    int maxNodeCount = 2*triangleCount - 1;
+
+    MeshBVHBuild build = { 0 };
+    float *bounds = (float *)RL_MALLOC(triangleCount*6*sizeof(float));
+    build.order = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    build.nodes = (MeshBVHNode *)RL_MALLOC(maxNodeCount*sizeof(MeshBVHNode));
+
+    // Get triangles bounds
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int index = (mesh->indices != NULL)? mesh->indices[i*3 + k] : i*3 + k;
+
+            for (int c = 0; c < 3; c++)
+            {
+                float value = mesh->vertices[index*3 + c];
+
+                if ((k == 0) || (value < bounds[i*6 + c])) bounds[i*6 + c] = value;
+                if ((k == 0) || (value > bounds[i*6 + 3 + c])) bounds[i*6 + 3 + c] = value;
+            }
+        }
+
+        build.order[i] = i;
+    }
+
+    build.bounds = bounds;
+
+    // Split the top nodes on the calling thread until there are enough subtrees to keep all threads busy,
+    // every subtree owns a range of node slots so they can be built at the same time
+    MeshBVHTask tasks[4*MAX_MODELS_THREADS] = { 0 };
+    int taskCount = 1;
+    int threadCount = GetModelsThreadCount();
+    tasks[0].count = triangleCount;
+
+    if ((threadCount > 1) && (triangleCount >= MESH_BVH_PARALLEL_TRIANGLES))
+    {
+        while ((taskCount > 0) && (taskCount < 4*threadCount))
+        {
+            int largest = 0;
+            for (int i = 1; i < taskCount; i++) if (tasks[i].count > tasks[largest].count) largest = i;
+            if (tasks[largest].count < MESH_BVH_PARALLEL_TRIANGLES/16) break;
+
+            MeshBVHTask task = tasks[largest];
+            int leftCount = SplitMeshBVHNode(&build, task);
+
+            if (leftCount > 0)
+            {
+                tasks[largest] = (MeshBVHTask){ task.slot + 1, task.first, leftCount, task.depth + 1 };
+                tasks[taskCount] = (MeshBVHTask){ task.slot + 2*leftCount, task.first + leftCount, task.count - leftCount, task.depth + 1 };
+                taskCount++;
+            }
+            else tasks[largest] = tasks[--taskCount];   // Leaf, nothing left to build
+        }
+    }
+
+    build.tasks = tasks;
+    RunModelsJob(BuildMeshBVHSubtree, &build, taskCount);
+
+    // Compact nodes in depth-first order, the first child of every internal node is the next node
+    MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+    bvh->nodes = (MeshBVHNode *)RL_MALLOC(maxNodeCount*sizeof(MeshBVHNode));
+    int *remap = (int *)RL_MALLOC(maxNodeCount*sizeof(int));
+    int stack[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    int stackSize = 1;
+
+    while (stackSize > 0)
+    {
+        int slot = stack[--stackSize];
+        MeshBVHNode node = build.nodes[slot];
+
+        remap[slot] = bvh->nodeCount;
+        bvh->nodes[bvh->nodeCount++] = node;
+
+        if (node.count == 0)
+        {
+            stack[stackSize++] = node.start;
+            stack[stackSize++] = slot + 1;
+        }
+    }
+
+    for (int i = 0; i < bvh->nodeCount; i++) if (bvh->nodes[i].count == 0) bvh->nodes[i].start = remap[bvh->nodes[i].start];
+
+    bvh->nodes = (MeshBVHNode *)RL_REALLOC(bvh->nodes, bvh->nodeCount*sizeof(MeshBVHNode));
+
+    // Store triangles in leaves order, as first vertex and two edges
+    bvh->triangleCount = triangleCount;
+    bvh->triangles = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        int triangle = build.order[i];
+        float *data = &bvh->triangles[i*9];
+        Vector3 v[3] = { 0 };
+
+        for (int k = 0; k < 3; k++)
+        {
+            int index = (mesh->indices != NULL)? mesh->indices[triangle*3 + k] : triangle*3 + k;
+            v[k] = (Vector3){ mesh->vertices[index*3], mesh->vertices[index*3 + 1], mesh->vertices[index*3 + 2] };
+        }
+
+        data[0] = v[0].x; data[1] = v[0].y; data[2] = v[0].z;
+        data[3] = v[1].x - v[0].x; data[4] = v[1].y - v[0].y; data[5] = v[1].z - v[0].z;
+        data[6] = v[2].x - v[0].x; data[7] = v[2].y - v[0].y; data[8] = v[2].z - v[0].z;
+    }
+
+    RL_FREE(remap);
+    RL_FREE(bounds);
+    RL_FREE(build.order);
+    RL_FREE(build.nodes);
+
+    mesh->bvh = bvh;
+
+    TRACELOG(LOG_INFO, "MESH: BVH generated successfully (%i triangles, %i nodes)", bvh->triangleCount, bvh->nodeCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -3764,49 +4082,32 @@ RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and mesh
+// NOTE: Ray is moved to model space, mesh BVH is used if available (GenMeshBVH())
 RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
 {
-    RayCollision collision = { 0 };
+    MeshRayQuery query = { 0 };
+    query.mesh = &mesh;
+    query.invTransform = MatrixInvert(transform);
+    query.normalSign = (MatrixDeterminant(transform) < 0.0f)? -1.0f : 1.0f;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
-    {
-        int triangleCount = mesh.triangleCount;
-
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
-        {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
-
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
-
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+    return GetRayCollisionMeshQuery(&query, ray);
+}
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+// Get collision info between multiple rays and mesh
+// NOTE: Rays are split between models worker threads if available
+void GetRayCollisionMeshBatch(const Ray *rays, int count, Mesh mesh, Matrix transform, RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (count <= 0)) return;
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
-            }
-        }
-    }
+    MeshRayQuery query = { 0 };
+    query.mesh = &mesh;
+    query.invTransform = MatrixInvert(transform);
+    query.normalSign = (MatrixDeterminant(transform) < 0.0f)? -1.0f : 1.0f;
+    query.rays = rays;
+    query.collisions = collisions;
+    query.count = count;
 
-    return collision;
+    RunModelsJob(GetRayCollisionMeshJob, &query, (count + MESH_RAYS_PER_JOB_ITEM - 1)/MESH_RAYS_PER_JOB_ITEM);
 }
 
 // Get collision info between ray and triangle
@@ -3885,6 +4186,607 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(MODELS_THREADS_AVAILABLE)
+static ModelsThreads modelsThreads = { 0 };
+static pthread_mutex_t modelsJobMutex = PTHREAD_MUTEX_INITIALIZER;      // Held by the thread running a job
+static pthread_mutex_t modelsThreadsMutex = PTHREAD_MUTEX_INITIALIZER;  // Protects job state
+static pthread_cond_t modelsJobStart = PTHREAD_COND_INITIALIZER;        // Signaled when a job starts
+static pthread_cond_t modelsJobDone = PTHREAD_COND_INITIALIZER;         // Signaled when all workers are done with a job
+
+// Run current job items until there are no items left
+static void RunModelsJobItems(void)
+{
+    while (true)
+    {
+        pthread_mutex_lock(&modelsThreadsMutex);
+        int item = modelsThreads.nextItem++;
+        pthread_mutex_unlock(&modelsThreadsMutex);
+
+        if (item >= modelsThreads.itemCount) break;
+
+        modelsThreads.job(modelsThreads.data, item);
+    }
+}
+
+// Models worker thread, waits for jobs and runs their items
+static void *ModelsWorkerThread(void *arg)
+{
+    unsigned int jobCounter = 0;
+
+    pthread_mutex_lock(&modelsThreadsMutex);
+
+    while (true)
+    {
+        while (modelsThreads.jobCounter == jobCounter) pthread_cond_wait(&modelsJobStart, &modelsThreadsMutex);
+        jobCounter = modelsThreads.jobCounter;
+        pthread_mutex_unlock(&modelsThreadsMutex);
+
+        RunModelsJobItems();
+
+        pthread_mutex_lock(&modelsThreadsMutex);
+        modelsThreads.workersRunning--;
+        if (modelsThreads.workersRunning == 0) pthread_cond_signal(&modelsJobDone);
+    }
+
+    return NULL;
+}
+#endif
+
+// Get number of threads working on models jobs (calling thread included)
+static int GetModelsThreadCount(void)
+{
+    int count = 1;
+
+#if defined(MODELS_THREADS_AVAILABLE)
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cores > MAX_MODELS_THREADS) count = MAX_MODELS_THREADS;
+    else if (cores > 1) count = (int)cores;
+#endif
+
+    return count;
+}
+
+// Run job items, split between the calling thread and models worker threads if available
+// NOTE: Only one job runs on worker threads at a time, jobs requested meanwhile (from other threads
+// or from job items) run all their items on the calling thread
+static void RunModelsJob(void (*job)(void *data, int item), void *data, int itemCount)
+{
+#if defined(MODELS_THREADS_AVAILABLE)
+    if ((itemCount > 1) && (pthread_mutex_trylock(&modelsJobMutex) == 0))
+    {
+        // Start worker threads on first job
+        if (modelsThreads.threadCount == 0)
+        {
+            int count = GetModelsThreadCount() - 1;
+
+            for (int i = 0; i < count; i++)
+            {
+                if (pthread_create(&modelsThreads.threads[i], NULL, ModelsWorkerThread, NULL) != 0) break;
+
+                pthread_detach(modelsThreads.threads[i]);
+                modelsThreads.threadCount++;
+            }
+
+            if (modelsThreads.threadCount > 0) TRACELOG(LOG_INFO, "MODELS: Worker threads started successfully (%i threads)", modelsThreads.threadCount);
+            else modelsThreads.threadCount = -1;
+        }
+
+        if (modelsThreads.threadCount > 0)
+        {
+            pthread_mutex_lock(&modelsThreadsMutex);
+            modelsThreads.job = job;
+            modelsThreads.data = data;
+            modelsThreads.itemCount = itemCount;
+            modelsThreads.nextItem = 0;
+            modelsThreads.workersRunning = modelsThreads.threadCount;
+            modelsThreads.jobCounter++;
+            pthread_cond_broadcast(&modelsJobStart);
+            pthread_mutex_unlock(&modelsThreadsMutex);
+
+            RunModelsJobItems();
+
+            pthread_mutex_lock(&modelsThreadsMutex);
+            while (modelsThreads.workersRunning > 0) pthread_cond_wait(&modelsJobDone, &modelsThreadsMutex);
+            pthread_mutex_unlock(&modelsThreadsMutex);
+
+            pthread_mutex_unlock(&modelsJobMutex);
+            return;
+        }
+
+        pthread_mutex_unlock(&modelsJobMutex);
+    }
+#endif
+
+    for (int i = 0; i < itemCount; i++) job(data, i);
+}
+
+// Unload mesh BVH data
+static void UnloadMeshBVH(MeshBVH *bvh)
+{
+    if (bvh == NULL) return;
+
+    RL_FREE(bvh->nodes);
+    RL_FREE(bvh->triangles);
+    RL_FREE(bvh);
+}
+
+// Get mesh BVH bin for a triangle centroid (doubled, bounds min plus max)
+static inline int GetMeshBVHBin(float center, float centerMin, float binScale, int binCount)
+{
+    int bin = (int)((center - centerMin)*binScale);
+
+    return (bin < binCount)? bin : binCount - 1;
+}
+
+// Get bounds half surface area
+static inline float GetMeshBVHArea(const float *min, const float *max)
+{
+    float dx = max[0] - min[0];
+    float dy = max[1] - min[1];
+    float dz = max[2] - min[2];
+
+    return dx*dy + dy*dz + dz*dx;
+}
+
+// Compute mesh BVH node bounds and split its triangles, returns left child triangles count (0 for leaves)
+// NOTE: Splits are evaluated with the surface area heuristic on centroid bins along every axis,
+// a triangle test is estimated as costly as a node test
+static int SplitMeshBVHNode(MeshBVHBuild *build, MeshBVHTask task)
+{
+    MeshBVHNode *node = &build->nodes[task.slot];
+    int *order = build->order + task.first;
+    float *bounds = build->bounds + task.first*6;
+    float centerMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float centerMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    for (int k = 0; k < 3; k++)
+    {
+        node->min[k] = FLT_MAX;
+        node->max[k] = -FLT_MAX;
+    }
+
+    for (int i = 0; i < task.count; i++)
+    {
+        const float *box = &bounds[i*6];
+
+        for (int k = 0; k < 3; k++)
+        {
+            float center = box[k] + box[k + 3];
+
+            if (box[k] < node->min[k]) node->min[k] = box[k];
+            if (box[k + 3] > node->max[k]) node->max[k] = box[k + 3];
+            if (center < centerMin[k]) centerMin[k] = center;
+            if (center > centerMax[k]) centerMax[k] = center;
+        }
+    }
+
+    node->start = task.first;
+    node->count = task.count;
+
+    if ((task.count == 1) || (task.depth >= MESH_BVH_MAX_DEPTH - 1)) return 0;
+
+    // Bin triangles along the three axes at once, small nodes use one bin per triangle
+    MeshBVHBin bins[3][MESH_BVH_BINS];
+    float binScale[3] = { 0 };
+    int binCount = (task.count < MESH_BVH_BINS)? task.count : MESH_BVH_BINS;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        if (centerMax[axis] > centerMin[axis]) binScale[axis] = binCount/(centerMax[axis] - centerMin[axis]);
+
+        for (int b = 0; b < binCount; b++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                bins[axis][b].min[k] = FLT_MAX;
+                bins[axis][b].max[k] = -FLT_MAX;
+            }
+
+            bins[axis][b].count = 0;
+        }
+    }
+
+    for (int i = 0; i < task.count; i++)
+    {
+        const float *box = &bounds[i*6];
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            MeshBVHBin *bin = &bins[axis][GetMeshBVHBin(box[axis] + box[axis + 3], centerMin[axis], binScale[axis], binCount)];
+
+            for (int k = 0; k < 3; k++)
+            {
+                if (box[k] < bin->min[k]) bin->min[k] = box[k];
+                if (box[k + 3] > bin->max[k]) bin->max[k] = box[k + 3];
+            }
+
+            bin->count++;
+        }
+    }
+
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestBin = 0;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        if (binScale[axis] == 0.0f) continue;
+
+        // Sweep bins from the left storing the cost of every left side, then from the right
+        float leftCost[MESH_BVH_BINS - 1] = { 0 };
+        MeshBVHBin side = bins[axis][0];
+
+        for (int b = 0; b < binCount - 1; b++)
+        {
+            if (b > 0)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    side.min[k] = fminf(side.min[k], bins[axis][b].min[k]);
+                    side.max[k] = fmaxf(side.max[k], bins[axis][b].max[k]);
+                }
+
+                side.count += bins[axis][b].count;
+            }
+
+            leftCost[b] = (side.count > 0)? side.count*GetMeshBVHArea(side.min, side.max) : -1.0f;
+        }
+
+        side = bins[axis][binCount - 1];
+
+        for (int b = binCount - 2; b >= 0; b--)
+        {
+            if ((side.count > 0) && (leftCost[b] >= 0.0f))
+            {
+                float cost = leftCost[b] + side.count*GetMeshBVHArea(side.min, side.max);
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+
+            for (int k = 0; k < 3; k++)
+            {
+                side.min[k] = fminf(side.min[k], bins[axis][b].min[k]);
+                side.max[k] = fmaxf(side.max[k], bins[axis][b].max[k]);
+            }
+
+            side.count += bins[axis][b].count;
+        }
+    }
+
+    float area = GetMeshBVHArea(node->min, node->max);
+
+    // Keep node as leaf if splitting is not cheaper
+    if (((bestAxis < 0) || (area + bestCost >= task.count*area)) && (task.count <= MESH_BVH_MAX_LEAF_TRIANGLES)) return 0;
+
+    int leftCount = task.count/2;
+
+    if (bestAxis >= 0)
+    {
+        // Partition triangles (and their bounds, to keep them contiguous) by bin
+        int i = 0;
+        int j = task.count - 1;
+
+        while (i <= j)
+        {
+            float *box = &bounds[i*6];
+
+            if (GetMeshBVHBin(box[bestAxis] + box[bestAxis + 3], centerMin[bestAxis], binScale[bestAxis], binCount) <= bestBin) i++;
+            else
+            {
+                float *other = &bounds[j*6];
+                int temp = order[i];
+                order[i] = order[j];
+                order[j] = temp;
+
+                for (int k = 0; k < 6; k++)
+                {
+                    float value = box[k];
+                    box[k] = other[k];
+                    other[k] = value;
+                }
+
+                j--;
+            }
+        }
+
+        if ((i > 0) && (i < task.count)) leftCount = i;
+    }
+
+    // Internal node, first child is in the next slot and second child after all first child slots
+    node->start = task.slot + 2*leftCount;
+    node->count = 0;
+
+    return leftCount;
+}
+
+// Build mesh BVH subtree (job item)
+static void BuildMeshBVHSubtree(void *data, int item)
+{
+    MeshBVHBuild *build = (MeshBVHBuild *)data;
+    MeshBVHTask stack[MESH_BVH_MAX_DEPTH] = { 0 };
+    int stackSize = 0;
+    MeshBVHTask task = build->tasks[item];
+
+    while (true)
+    {
+        int leftCount = SplitMeshBVHNode(build, task);
+
+        if (leftCount > 0)
+        {
+            MeshBVHTask left = { task.slot + 1, task.first, leftCount, task.depth + 1 };
+            MeshBVHTask right = { task.slot + 2*leftCount, task.first + leftCount, task.count - leftCount, task.depth + 1 };
+
+            // Continue with the smaller child, it keeps the stack below log2(triangles) entries
+            if (left.count < right.count) { stack[stackSize++] = right; task = left; }
+            else { stack[stackSize++] = left; task = right; }
+        }
+        else if (stackSize > 0) task = stack[--stackSize];
+        else break;
+    }
+}
+
+// Get distance to mesh BVH node bounds along ray, FLT_MAX if missed
+static inline float GetRayMeshBVHNodeDistance(const MeshBVHNode *node, Vector3 origin, Vector3 invDirection)
+{
+    float t1 = (node->min[0] - origin.x)*invDirection.x;
+    float t2 = (node->max[0] - origin.x)*invDirection.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (node->min[1] - origin.y)*invDirection.y;
+    t2 = (node->max[1] - origin.y)*invDirection.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (node->min[2] - origin.z)*invDirection.z;
+    t2 = (node->max[2] - origin.z)*invDirection.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    return ((tmax >= tmin) && (tmax >= 0.0f))? tmin : FLT_MAX;
+}
+
+// Get distance to triangle along ray, 0.0f if missed
+// NOTE: Same test as GetRayCollisionTriangle(), triangle is provided as first vertex and two edges
+static inline float GetRayTriangleDistance(Vector3 origin, Vector3 direction, Vector3 p1, Vector3 edge1, Vector3 edge2)
+{
+    Vector3 p = Vector3CrossProduct(direction, edge2);
+    float det = Vector3DotProduct(edge1, p);
+
+    if ((det > -EPSILON) && (det < EPSILON)) return 0.0f;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = Vector3Subtract(origin, p1);
+    float u = Vector3DotProduct(tv, p)*invDet;
+
+    if ((u < 0.0f) || (u > 1.0f)) return 0.0f;
+
+    Vector3 q = Vector3CrossProduct(tv, edge1);
+    float v = Vector3DotProduct(direction, q)*invDet;
+
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return 0.0f;
+
+    float t = Vector3DotProduct(edge2, q)*invDet;
+
+    return (t > EPSILON)? t : 0.0f;
+}
+
+// Get collision info between ray and query mesh
+// NOTE: Ray direction is moved to model space without normalizing, so distances along it match world space
+static RayCollision GetRayCollisionMeshQuery(const MeshRayQuery *query, Ray ray)
+{
+    RayCollision collision = { 0 };
+    const Mesh *mesh = query->mesh;
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh->vertices == NULL) return collision;
+
+    Matrix inv = query->invTransform;
+    Vector3 origin = Vector3Transform(ray.position, inv);
+    Vector3 direction = {
+        inv.m0*ray.direction.x + inv.m4*ray.direction.y + inv.m8*ray.direction.z,
+        inv.m1*ray.direction.x + inv.m5*ray.direction.y + inv.m9*ray.direction.z,
+        inv.m2*ray.direction.x + inv.m6*ray.direction.y + inv.m10*ray.direction.z
+    };
+
+    float distance = FLT_MAX;
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+
+    if (mesh->bvh != NULL)
+    {
+        // Traverse nodes nearest first, skipping nodes farther than closest hit
+        const MeshBVH *bvh = mesh->bvh;
+        Vector3 invDirection = { 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+        int stack[MESH_BVH_MAX_DEPTH] = { 0 };
+        float stackDistance[MESH_BVH_MAX_DEPTH] = { 0 };
+        int stackSize = 0;
+        int index = (GetRayMeshBVHNodeDistance(&bvh->nodes[0], origin, invDirection) < FLT_MAX)? 0 : -1;
+
+        while (index >= 0)
+        {
+            const MeshBVHNode *node = &bvh->nodes[index];
+            index = -1;
+
+            if (node->count > 0)
+            {
+                for (int i = node->start; i < node->start + node->count; i++)
+                {
+                    const float *data = &bvh->triangles[i*9];
+                    Vector3 p1 = { data[0], data[1], data[2] };
+                    Vector3 e1 = { data[3], data[4], data[5] };
+                    Vector3 e2 = { data[6], data[7], data[8] };
+                    float t = GetRayTriangleDistance(origin, direction, p1, e1, e2);
+
+                    if ((t > 0.0f) && (t < distance))
+                    {
+                        distance = t;
+                        edge1 = e1;
+                        edge2 = e2;
+                    }
+                }
+            }
+            else
+            {
+                int nearIndex = (int)(node - bvh->nodes) + 1;
+                int farIndex = node->start;
+                float nearDistance = GetRayMeshBVHNodeDistance(&bvh->nodes[nearIndex], origin, invDirection);
+                float farDistance = GetRayMeshBVHNodeDistance(&bvh->nodes[farIndex], origin, invDirection);
+
+                if (farDistance < nearDistance)
+                {
+                    int temp = nearIndex; nearIndex = farIndex; farIndex = temp;
+                    float tempDistance = nearDistance; nearDistance = farDistance; farDistance = tempDistance;
+                }
+
+                if (nearDistance < distance)
+                {
+                    index = nearIndex;
+
+                    if (farDistance < distance)
+                    {
+                        stack[stackSize] = farIndex;
+                        stackDistance[stackSize] = farDistance;
+                        stackSize++;
+                    }
+                }
+            }
+
+            // Continue with the last pending node still nearer than closest hit
+            while ((index < 0) && (stackSize > 0))
+            {
+                stackSize--;
+                if (stackDistance[stackSize] < distance) index = stack[stackSize];
+            }
+        }
+    }
+    else
+    {
+        // Test against all triangles in mesh
+        for (int i = 0; i < mesh->triangleCount; i++)
+        {
+            Vector3 v[3] = { 0 };
+
+            for (int k = 0; k < 3; k++)
+            {
+                int index = (mesh->indices != NULL)? mesh->indices[i*3 + k] : i*3 + k;
+                v[k] = (Vector3){ mesh->vertices[index*3], mesh->vertices[index*3 + 1], mesh->vertices[index*3 + 2] };
+            }
+
+            Vector3 e1 = Vector3Subtract(v[1], v[0]);
+            Vector3 e2 = Vector3Subtract(v[2], v[0]);
+            float t = GetRayTriangleDistance(origin, direction, v[0], e1, e2);
+
+            if ((t > 0.0f) && (t < distance))
+            {
+                distance = t;
+                edge1 = e1;
+                edge2 = e2;
+            }
+        }
+    }
+
+    if (distance < FLT_MAX)
+    {
+        // Move normal back to world space with the inverse transform transposed
+        Vector3 normal = Vector3CrossProduct(edge1, edge2);
+
+        collision.hit = true;
+        collision.distance = distance;
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+        collision.normal = Vector3Normalize((Vector3){
+            query->normalSign*(inv.m0*normal.x + inv.m1*normal.y + inv.m2*normal.z),
+            query->normalSign*(inv.m4*normal.x + inv.m5*normal.y + inv.m6*normal.z),
+            query->normalSign*(inv.m8*normal.x + inv.m9*normal.y + inv.m10*normal.z)
+        });
+    }
+
+    return collision;
+}
+
+// Check if mesh can be skinned on GPU when drawn with shader
+// NOTE: Mesh requires bones vertex buffers, default shader is replaced by default skinning shader
+// (if bones fit in it) and custom shaders must provide the bone matrices uniform
+static bool IsMeshSkinnableGPU(const Mesh *mesh, int boneCount, Shader shader)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if ((mesh->vboId != NULL) && (mesh->vboId[7] > 0) && (mesh->vboId[8] > 0))
+    {
+        if (shader.id == rlGetShaderIdDefault()) result = (boneCount <= rlGetShaderBonesDefaultSkinning());
+        else result = (shader.locs != NULL) && (shader.locs[SHADER_LOC_BONE_MATRICES] != -1);
+    }
+#endif
+
+    return result;
+}
+
+// Skin mesh vertices range (job item)
+// NOTE: Bones matrices are blended by weight before transforming vertex once (linear blend skinning),
+// palette keeps every bone rows contiguous so blending vectorizes
+static void SkinMeshVertices(void *data, int item)
+{
+    const MeshSkinJob *job = (const MeshSkinJob *)data;
+    const Mesh *mesh = job->mesh;
+    bool normals = (mesh->normals != NULL) && (mesh->animNormals != NULL);
+
+    int first = item*MESH_SKIN_VERTICES_PER_JOB_ITEM;
+    int last = first + MESH_SKIN_VERTICES_PER_JOB_ITEM;
+    if (last > mesh->vertexCount) last = mesh->vertexCount;
+
+    for (int v = first; v < last; v++)
+    {
+        float blend[MESH_SKIN_BONE_FLOATS] = { 0 };
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            float weight = mesh->boneWeights[v*4 + j];
+
+            // Early stop when no transformation will be applied
+            if (weight == 0.0f) continue;
+
+            const float *bone = &job->palette[mesh->boneIds[v*4 + j]*MESH_SKIN_BONE_FLOATS];
+            for (int k = 0; k < MESH_SKIN_BONE_FLOATS; k++) blend[k] += bone[k]*weight;
+        }
+
+        // NOTE: We use mesh.vertices (default vertex position) to calculate mesh.animVertices (animated vertex position)
+        float x = mesh->vertices[v*3];
+        float y = mesh->vertices[v*3 + 1];
+        float z = mesh->vertices[v*3 + 2];
+        mesh->animVertices[v*3] = blend[0]*x + blend[1]*y + blend[2]*z + blend[3];
+        mesh->animVertices[v*3 + 1] = blend[4]*x + blend[5]*y + blend[6]*z + blend[7];
+        mesh->animVertices[v*3 + 2] = blend[8]*x + blend[9]*y + blend[10]*z + blend[11];
+
+        if (normals)
+        {
+            x = mesh->normals[v*3];
+            y = mesh->normals[v*3 + 1];
+            z = mesh->normals[v*3 + 2];
+            mesh->animNormals[v*3] = blend[12]*x + blend[13]*y + blend[14]*z;
+            mesh->animNormals[v*3 + 1] = blend[16]*x + blend[17]*y + blend[18]*z;
+            mesh->animNormals[v*3 + 2] = blend[20]*x + blend[21]*y + blend[22]*z;
+        }
+    }
+}
+
+// Get collision info between rays and query mesh (job item)
+static void GetRayCollisionMeshJob(void *data, int item)
+{
+    const MeshRayQuery *query = (const MeshRayQuery *)data;
+    int last = (item + 1)*MESH_RAYS_PER_JOB_ITEM;
+    if (last > query->count) last = query->count;
+
+    for (int i = item*MESH_RAYS_PER_JOB_ITEM; i < last; i++) query->collisions[i] = GetRayCollisionMeshQuery(query, query->rays[i]);
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
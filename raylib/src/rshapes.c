@@ -15,6 +15,15 @@
 *       white character of default font [rtext], this way, raylib text and shapes can be draw with
 *       a single draw call and it also allows users to configure it the same way with their own fonts.
 *
+*       Circles, rings, rounded rectangles and thick lines can also be drawn as one quad each, with
+*       anti-aliased edges computed by a signed distance functions shader [rlgl], selecting it with
+*       SetShapesRenderMode(SHAPES_RENDER_SDF) for the whole program or just some part of a frame.
+*       Every run of SDF shapes is one instanced draw call, kept in order with the rest of the render
+*       batch, so grouping them together saves draw calls. SDF shapes are solid color, they ignore the
+*       texture set with SetShapesTexture(): use SHAPES_RENDER_TESSELLATED for textured shapes.
+*       When a shape can not be drawn this way (OpenGL 1.1/2.1/ES2, render batch recorders, custom
+*       shader or transform matrix not keeping shape proportions) it is tessellated as usual.
+*
 *   CONFIGURATION:
 *       #define SUPPORT_MODULE_RSHAPES
 *           rshapes module is included in the build
@@ -55,7 +64,7 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), atan2f(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
 
@@ -70,12 +79,46 @@
 #ifndef SPLINE_SEGMENT_DIVISIONS
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
+#ifndef CIRCLE_CACHE_ARCS
+    #define CIRCLE_CACHE_ARCS              8      // Circle arcs kept in circle points cache
+#endif
+#ifndef CIRCLE_CACHE_MAX_SEGMENTS
+    #define CIRCLE_CACHE_MAX_SEGMENTS    128      // Maximum segments of cached circle arcs, points of larger arcs are computed on every draw
+#endif
+
+// Vertices gathered by shapes before submitting them to rlgl in one array,
+// it must be a multiple of 2, 3 and 4 so only whole lines, triangles and quads are submitted
+#define SHAPE_BUFFER_VERTICES            240
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Shape vertices waiting to be submitted with rlVertexArray2fEx()
+typedef struct ShapeBuffer {
+    float vertices[2*SHAPE_BUFFER_VERTICES];    // Vertex positions (XY)
+    float texcoords[2*SHAPE_BUFFER_VERTICES];   // Vertex texture coordinates (UV), only if set
+    float texcoord[2];                          // Texture coordinate for next vertices
+    int vertexCount;                            // Number of vertices gathered
+    bool useTexcoords;                          // Texture coordinates set for gathered vertices
+} ShapeBuffer;
+
+// Cached circle arc, unit circle points from angle 0 to sweep angle
+typedef struct CircleArcPoints {
+    int segments;                               // Arc segments (0 for unused entries)
+    float sweep;                                // Arc sweep angle (degrees)
+    float points[2*(CIRCLE_CACHE_MAX_SEGMENTS + 1)];    // Unit circle points (XY), segments + 1 points
+} CircleArcPoints;
+
+// Circle arc to be drawn, unit circle points from start angle divided in segments
+// NOTE: Cached points are rotated to the start angle, points of arcs not cached are computed with cosf()/sinf()
+typedef struct CircleArc {
+    const float *points;                        // Cached unit circle points (XY) from angle 0, NULL if not cached
+    float cosStart;                             // Start angle cosine
+    float sinStart;                             // Start angle sine
+    float startAngle;                           // Start angle (degrees)
+    float stepLength;                           // Segment angle (degrees)
+} CircleArc;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +126,23 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (white pixel loaded by rlgl)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static int shapesRenderMode = SHAPES_RENDER_TESSELLATED;  // Shapes render mode (ShapesRenderMode)
+
+static RL_THREAD_LOCAL ShapeBuffer shapeBuffer = { 0 };    // Shape vertices waiting to be submitted to rlgl (per thread, for rlgl recorders)
+
+static RL_THREAD_LOCAL CircleArcPoints circleCache[CIRCLE_CACHE_ARCS] = { 0 };    // Circle arcs points cache (per thread, for rlgl recorders)
+static RL_THREAD_LOCAL int circleCacheNext = 0;             // Next circle arcs cache entry to be replaced
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void BufferShapeTexCoord(float x, float y);                  // Set texture coordinate for next shape vertices
+static void BufferShapeVertex(float x, float y);                    // Add one shape vertex, submitted when the buffer is full
+static void SubmitShapeVertices(void);                              // Submit gathered shape vertices to rlgl
+static float GetCircleSegments(float radius);                       // Get number of segments for a smooth circle of a given radius
+static CircleArc GetCircleArc(float startAngle, float endAngle, int segments);  // Get circle arc, unit circle points cached by segments and sweep angle
+static Vector2 GetCircleArcPoint(const CircleArc *arc, int index);  // Get circle arc unit circle point, index in [0..segments]
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -112,6 +168,19 @@ void SetShapesTexture(Texture2D texture, Rectangle source)
     }
 }
 
+// Set shapes render mode (ShapesRenderMode)
+// NOTE: SDF shapes ignore shapes texture (see SetShapesTexture()), they are drawn with a solid color
+void SetShapesRenderMode(int mode)
+{
+    shapesRenderMode = mode;
+}
+
+// Get shapes render mode (ShapesRenderMode)
+int GetShapesRenderMode(void)
+{
+    return shapesRenderMode;
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -191,9 +260,10 @@ void DrawLineStrip(Vector2 *points, int pointCount, Color color)
 
             for (int i = 0; i < pointCount - 1; i++)
             {
-                rlVertex2f(points[i].x, points[i].y);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                BufferShapeVertex(points[i].x, points[i].y);
+                BufferShapeVertex(points[i + 1].x, points[i + 1].y);
             }
+            SubmitShapeVertices();
         rlEnd();
     }
 }
@@ -244,6 +314,12 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 
     if ((length > 0) && (thick > 0))
     {
+        if (shapesRenderMode == SHAPES_RENDER_SDF)
+        {
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            if (rlShapeBoxSDF((startPos.x + endPos.x)/2.0f, (startPos.y + endPos.y)/2.0f, length/2.0f, thick/2.0f, atan2f(delta.y, delta.x)*RAD2DEG, 0.0f, 0.0f)) return;
+        }
+
         float scale = thick/(2*length);
 
         Vector2 radius = { -scale*delta.y, scale*delta.x };
@@ -285,19 +361,22 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
         endAngle = tmp;
     }
 
+    if (shapesRenderMode == SHAPES_RENDER_SDF)
+    {
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        if (rlShapeCircleSDF(center.x, center.y, radius, 0.0f, startAngle, endAngle)) return;
+    }
+
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleArc arc = GetCircleArc(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -307,41 +386,47 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            Vector2 p0 = GetCircleArcPoint(&arc, 2*i);
+            Vector2 p1 = GetCircleArcPoint(&arc, 2*i + 1);
+            Vector2 p2 = GetCircleArcPoint(&arc, 2*i + 2);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x, center.y);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x + p2.x*radius, center.y + p2.y*radius);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
 
-            angle += (stepLength*2.0f);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if ((segments%2) == 1)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, segments - 1);
+            Vector2 p1 = GetCircleArcPoint(&arc, segments);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x, center.y);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x, center.y);
         }
 
+        SubmitShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
@@ -349,14 +434,16 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            angle += stepLength;
+            BufferShapeVertex(center.x, center.y);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
         }
+        SubmitShapeVertices();
     rlEnd();
 #endif
 }
@@ -379,41 +466,44 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleArc arc = GetCircleArc(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, 0);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            BufferShapeVertex(center.x, center.y);
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            angle += stepLength;
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
         }
 
         if (showCapLines)
         {
+            Vector2 p1 = GetCircleArcPoint(&arc, segments);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            BufferShapeVertex(center.x, center.y);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
@@ -421,15 +511,20 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    CircleArc arc = GetCircleArc(0.0f, 360.0f, 36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + p1.x*radius, (float)centerY + p1.y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + p0.x*radius, (float)centerY + p0.y*radius);
         }
     rlEnd();
 }
@@ -443,42 +538,67 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw circle outline (Vector version)
 void DrawCircleLinesV(Vector2 center, float radius, Color color)
 {
+    // NOTE: SDF outline is one pixel wide, centered on the circle
+    if (shapesRenderMode == SHAPES_RENDER_SDF)
+    {
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        if (rlShapeCircleSDF(center.x, center.y, radius + 0.5f, 1.0f, 0.0f, 360.0f)) return;
+    }
+
+    CircleArc arc = GetCircleArc(0.0f, 360.0f, 36);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        // NOTE: Circle outline is drawn in 36 segments, every 10 degrees
+        for (int i = 0; i < 36; i++)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
+            BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
+            BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    CircleArc arc = GetCircleArc(0.0f, 360.0f, 36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            BufferShapeVertex((float)centerX, (float)centerY);
+            BufferShapeVertex((float)centerX + p1.x*radiusH, (float)centerY + p1.y*radiusV);
+            BufferShapeVertex((float)centerX + p0.x*radiusH, (float)centerY + p0.y*radiusV);
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    CircleArc arc = GetCircleArc(0.0f, 360.0f, 36);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            BufferShapeVertex(centerX + p1.x*radiusH, centerY + p1.y*radiusV);
+            BufferShapeVertex(centerX + p0.x*radiusH, centerY + p0.y*radiusV);
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
@@ -510,9 +630,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -524,8 +642,13 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if ((shapesRenderMode == SHAPES_RENDER_SDF) && (innerRadius < outerRadius))
+    {
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        if (rlShapeCircleSDF(center.x, center.y, outerRadius, outerRadius - innerRadius, startAngle, endAngle)) return;
+    }
+
+    CircleArc arc = GetCircleArc(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -533,22 +656,24 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_QUADS);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
 
-            angle += stepLength;
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
         }
+        SubmitShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
@@ -556,18 +681,20 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+            BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+            BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-            angle += stepLength;
+            BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+            BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+            BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
         }
+        SubmitShapeVertices();
     rlEnd();
 #endif
 }
@@ -600,9 +727,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -613,37 +738,42 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleArc arc = GetCircleArc(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
+            Vector2 p0 = GetCircleArcPoint(&arc, 0);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+            BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            Vector2 p0 = GetCircleArcPoint(&arc, i);
+            Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+            BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
 
-            angle += stepLength;
+            BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+            BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
         }
 
         if (showCapLines)
         {
+            Vector2 p1 = GetCircleArcPoint(&arc, segments);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+            BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
@@ -864,16 +994,19 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if (shapesRenderMode == SHAPES_RENDER_SDF)
+    {
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        if (rlShapeBoxSDF(rec.x + rec.width/2.0f, rec.y + rec.height/2.0f, rec.width/2.0f, rec.height/2.0f, 0.0f, radius, 0.0f)) return;
+    }
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        segments = (int)(GetCircleSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
 
     /*
     Quick sketch to make sense of all of this,
@@ -910,101 +1043,107 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            CircleArc arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
+                Vector2 p0 = GetCircleArcPoint(&arc, 2*i);
+                Vector2 p1 = GetCircleArcPoint(&arc, 2*i + 1);
+                Vector2 p2 = GetCircleArcPoint(&arc, 2*i + 2);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(center.x, center.y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(center.x + p2.x*radius, center.y + p2.y*radius);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
 
-                angle += (stepLength*2);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
+                Vector2 p0 = GetCircleArcPoint(&arc, segments - 1);
+                Vector2 p1 = GetCircleArcPoint(&arc, segments);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(center.x, center.y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(center.x, center.y);
             }
         }
 
         // [2] Upper Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[0].x, point[0].y);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[1].x, point[1].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[0].x, point[0].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[1].x, point[1].y);
 
         // [4] Right Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[2].x, point[2].y);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[3].x, point[3].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[2].x, point[2].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[10].x, point[10].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[3].x, point[3].y);
 
         // [6] Bottom Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[5].x, point[5].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[4].x, point[4].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[5].x, point[5].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[4].x, point[4].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[10].x, point[10].y);
 
         // [8] Left Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[7].x, point[7].y);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[6].x, point[6].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[7].x, point[7].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[6].x, point[6].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[8].x, point[8].y);
 
         // [9] Middle Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        BufferShapeVertex(point[10].x, point[10].y);
+        BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        BufferShapeVertex(point[9].x, point[9].y);
+
+        SubmitShapeVertices();
     rlEnd();
     rlSetTexture(0);
 #else
@@ -1013,62 +1152,65 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            CircleArc arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
+                Vector2 p0 = GetCircleArcPoint(&arc, i);
+                Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
-                rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                BufferShapeVertex(center.x, center.y);
+                BufferShapeVertex(center.x + p1.x*radius, center.y + p1.y*radius);
+                BufferShapeVertex(center.x + p0.x*radius, center.y + p0.y*radius);
             }
         }
 
         // [2] Upper Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[0].x, point[0].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[1].x, point[1].y);
-        rlVertex2f(point[0].x, point[0].y);
-        rlVertex2f(point[9].x, point[9].y);
+        BufferShapeVertex(point[0].x, point[0].y);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeVertex(point[1].x, point[1].y);
+        BufferShapeVertex(point[0].x, point[0].y);
+        BufferShapeVertex(point[9].x, point[9].y);
 
         // [4] Right Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[3].x, point[3].y);
-        rlVertex2f(point[2].x, point[2].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[3].x, point[3].y);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeVertex(point[10].x, point[10].y);
+        BufferShapeVertex(point[3].x, point[3].y);
+        BufferShapeVertex(point[2].x, point[2].y);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeVertex(point[3].x, point[3].y);
 
         // [6] Bottom Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[5].x, point[5].y);
-        rlVertex2f(point[4].x, point[4].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[4].x, point[4].y);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeVertex(point[5].x, point[5].y);
+        BufferShapeVertex(point[4].x, point[4].y);
+        BufferShapeVertex(point[10].x, point[10].y);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeVertex(point[4].x, point[4].y);
 
         // [8] Left Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[7].x, point[7].y);
-        rlVertex2f(point[6].x, point[6].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[7].x, point[7].y);
-        rlVertex2f(point[11].x, point[11].y);
+        BufferShapeVertex(point[7].x, point[7].y);
+        BufferShapeVertex(point[6].x, point[6].y);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeVertex(point[7].x, point[7].y);
+        BufferShapeVertex(point[11].x, point[11].y);
 
         // [9] Middle Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[10].x, point[10].y);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeVertex(point[11].x, point[11].y);
+        BufferShapeVertex(point[10].x, point[10].y);
+        BufferShapeVertex(point[9].x, point[9].y);
+        BufferShapeVertex(point[8].x, point[8].y);
+        BufferShapeVertex(point[10].x, point[10].y);
+        SubmitShapeVertices();
     rlEnd();
 #endif
 }
@@ -1091,16 +1233,24 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    // NOTE: Outlines up to one pixel thick are drawn with lines lineThick away from the rectangle,
+    // SDF outline is one pixel wide and centered on those lines
+    if (shapesRenderMode == SHAPES_RENDER_SDF)
+    {
+        float thick = (lineThick > 1)? lineThick : 1.0f;
+        float offset = (lineThick > 1)? lineThick : lineThick + 0.5f;
+
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        if (rlShapeBoxSDF(rec.x + rec.width/2.0f, rec.y + rec.height/2.0f, rec.width/2.0f + offset, rec.height/2.0f + offset, 0.0f, radius + offset, thick)) return;
+    }
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        segments = (int)(GetCircleSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1146,72 +1296,74 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleArc arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
+                    Vector2 p0 = GetCircleArcPoint(&arc, i);
+                    Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-                    rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+                    rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                    BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
 
-                    rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                    BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
 
-                    rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                    BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
 
-                    angle += stepLength;
+                    BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                    BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
                 }
             }
 
             // Upper rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[0].x, point[0].y);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[8].x, point[8].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[9].x, point[9].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[1].x, point[1].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[0].x, point[0].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[8].x, point[8].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[9].x, point[9].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[1].x, point[1].y);
 
             // Right rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[2].x, point[2].y);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[10].x, point[10].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[11].x, point[11].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[3].x, point[3].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[2].x, point[2].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[10].x, point[10].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[11].x, point[11].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[3].x, point[3].y);
 
             // Lower rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[13].x, point[13].y);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[5].x, point[5].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[4].x, point[4].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[12].x, point[12].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[13].x, point[13].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[5].x, point[5].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[4].x, point[4].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[12].x, point[12].y);
 
             // Left rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[15].x, point[15].y);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[7].x, point[7].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(point[6].x, point[6].y);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(point[14].x, point[14].y);
-
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[15].x, point[15].y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[7].x, point[7].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(point[6].x, point[6].y);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(point[14].x, point[14].y);
+
+            SubmitShapeVertices();
         rlEnd();
         rlSetTexture(0);
 #else
@@ -1220,60 +1372,62 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleArc arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
+                    Vector2 p0 = GetCircleArcPoint(&arc, i);
+                    Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    BufferShapeVertex(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+                    BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+                    BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-                    angle += stepLength;
+                    BufferShapeVertex(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+                    BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+                    BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
                 }
             }
 
             // Upper rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[0].x, point[0].y);
-            rlVertex2f(point[8].x, point[8].y);
-            rlVertex2f(point[9].x, point[9].y);
-            rlVertex2f(point[1].x, point[1].y);
-            rlVertex2f(point[0].x, point[0].y);
-            rlVertex2f(point[9].x, point[9].y);
+            BufferShapeVertex(point[0].x, point[0].y);
+            BufferShapeVertex(point[8].x, point[8].y);
+            BufferShapeVertex(point[9].x, point[9].y);
+            BufferShapeVertex(point[1].x, point[1].y);
+            BufferShapeVertex(point[0].x, point[0].y);
+            BufferShapeVertex(point[9].x, point[9].y);
 
             // Right rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[10].x, point[10].y);
-            rlVertex2f(point[11].x, point[11].y);
-            rlVertex2f(point[3].x, point[3].y);
-            rlVertex2f(point[2].x, point[2].y);
-            rlVertex2f(point[10].x, point[10].y);
-            rlVertex2f(point[3].x, point[3].y);
+            BufferShapeVertex(point[10].x, point[10].y);
+            BufferShapeVertex(point[11].x, point[11].y);
+            BufferShapeVertex(point[3].x, point[3].y);
+            BufferShapeVertex(point[2].x, point[2].y);
+            BufferShapeVertex(point[10].x, point[10].y);
+            BufferShapeVertex(point[3].x, point[3].y);
 
             // Lower rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[13].x, point[13].y);
-            rlVertex2f(point[5].x, point[5].y);
-            rlVertex2f(point[4].x, point[4].y);
-            rlVertex2f(point[12].x, point[12].y);
-            rlVertex2f(point[13].x, point[13].y);
-            rlVertex2f(point[4].x, point[4].y);
+            BufferShapeVertex(point[13].x, point[13].y);
+            BufferShapeVertex(point[5].x, point[5].y);
+            BufferShapeVertex(point[4].x, point[4].y);
+            BufferShapeVertex(point[12].x, point[12].y);
+            BufferShapeVertex(point[13].x, point[13].y);
+            BufferShapeVertex(point[4].x, point[4].y);
 
             // Left rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[7].x, point[7].y);
-            rlVertex2f(point[6].x, point[6].y);
-            rlVertex2f(point[14].x, point[14].y);
-            rlVertex2f(point[15].x, point[15].y);
-            rlVertex2f(point[7].x, point[7].y);
-            rlVertex2f(point[14].x, point[14].y);
+            BufferShapeVertex(point[7].x, point[7].y);
+            BufferShapeVertex(point[6].x, point[6].y);
+            BufferShapeVertex(point[14].x, point[14].y);
+            BufferShapeVertex(point[15].x, point[15].y);
+            BufferShapeVertex(point[7].x, point[7].y);
+            BufferShapeVertex(point[14].x, point[14].y);
+            SubmitShapeVertices();
         rlEnd();
 #endif
     }
@@ -1285,15 +1439,17 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleArc arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 p0 = GetCircleArcPoint(&arc, i);
+                    Vector2 p1 = GetCircleArcPoint(&arc, i + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    BufferShapeVertex(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+                    BufferShapeVertex(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
                 }
             }
 
@@ -1301,10 +1457,11 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             for (int i = 0; i < 8; i += 2)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
-                rlVertex2f(point[i].x, point[i].y);
-                rlVertex2f(point[i + 1].x, point[i + 1].y);
+                BufferShapeVertex(point[i].x, point[i].y);
+                BufferShapeVertex(point[i + 1].x, point[i + 1].y);
             }
 
+            SubmitShapeVertices();
         rlEnd();
     }
 }
@@ -1373,18 +1530,19 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
 
             for (int i = 1; i < pointCount - 1; i++)
             {
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(points[0].x, points[0].y);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(points[0].x, points[0].y);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(points[i].x, points[i].y);
+                BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(points[i].x, points[i].y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                BufferShapeVertex(points[i + 1].x, points[i + 1].y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                BufferShapeVertex(points[i + 1].x, points[i + 1].y);
             }
+            SubmitShapeVertices();
         rlEnd();
         rlSetTexture(0);
     }
@@ -1403,17 +1561,18 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
             {
                 if ((i%2) == 0)
                 {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
+                    BufferShapeVertex(points[i].x, points[i].y);
+                    BufferShapeVertex(points[i - 2].x, points[i - 2].y);
+                    BufferShapeVertex(points[i - 1].x, points[i - 1].y);
                 }
                 else
                 {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
+                    BufferShapeVertex(points[i].x, points[i].y);
+                    BufferShapeVertex(points[i - 1].x, points[i - 1].y);
+                    BufferShapeVertex(points[i - 2].x, points[i - 2].y);
                 }
             }
+            SubmitShapeVertices();
         rlEnd();
     }
 }
@@ -1434,20 +1593,21 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
             rlColor4ub(color.r, color.g, color.b, color.a);
             float nextAngle = centralAngle + angleStep;
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x, center.y);
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            BufferShapeTexCoord(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            BufferShapeVertex(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            BufferShapeTexCoord((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            BufferShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
 
             centralAngle = nextAngle;
         }
+        SubmitShapeVertices();
     rlEnd();
     rlSetTexture(0);
 #else
@@ -1456,12 +1616,13 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            BufferShapeVertex(center.x, center.y);
+            BufferShapeVertex(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
+            BufferShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
 
             centralAngle += angleStep;
         }
+        SubmitShapeVertices();
     rlEnd();
 #endif
 }
@@ -1478,11 +1639,12 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
+            BufferShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            BufferShapeVertex(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
 
             centralAngle += angleStep;
         }
+        SubmitShapeVertices();
     rlEnd();
 }
 
@@ -2241,4 +2403,125 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
 
+// Set texture coordinate for next shape vertices
+static void BufferShapeTexCoord(float x, float y)
+{
+    shapeBuffer.texcoord[0] = x;
+    shapeBuffer.texcoord[1] = y;
+    shapeBuffer.useTexcoords = true;
+}
+
+// Add one shape vertex, using current rlgl color
+// NOTE: Vertices are submitted to rlgl when the buffer is full or by SubmitShapeVertices()
+static void BufferShapeVertex(float x, float y)
+{
+    shapeBuffer.vertices[2*shapeBuffer.vertexCount] = x;
+    shapeBuffer.vertices[2*shapeBuffer.vertexCount + 1] = y;
+    shapeBuffer.texcoords[2*shapeBuffer.vertexCount] = shapeBuffer.texcoord[0];
+    shapeBuffer.texcoords[2*shapeBuffer.vertexCount + 1] = shapeBuffer.texcoord[1];
+    shapeBuffer.vertexCount++;
+
+    if (shapeBuffer.vertexCount == SHAPE_BUFFER_VERTICES) SubmitShapeVertices();
+}
+
+// Submit gathered shape vertices to rlgl, transformed and batch checked once for all of them
+static void SubmitShapeVertices(void)
+{
+    rlVertexArray2fEx(shapeBuffer.vertices, shapeBuffer.useTexcoords? shapeBuffer.texcoords : NULL, NULL, shapeBuffer.vertexCount);
+
+    shapeBuffer.vertexCount = 0;
+    shapeBuffer.useTexcoords = false;
+}
+
+// Get number of segments for a smooth circle of a given radius (for 360 degrees)
+// NOTE: Last radius is remembered, shapes are usually drawn many times with the same radius
+static float GetCircleSegments(float radius)
+{
+    static RL_THREAD_LOCAL float lastRadius = 0.0f;
+    static RL_THREAD_LOCAL float lastSegments = 0.0f;
+
+    if (radius != lastRadius)
+    {
+        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+
+        lastSegments = ceilf(2*PI/th);
+        lastRadius = radius;
+    }
+
+    return lastSegments;
+}
+
+// Get circle arc from start angle to end angle divided in segments
+// NOTE: Unit circle points are cached by segments and sweep angle, they are shared by arcs with any start angle
+static CircleArc GetCircleArc(float startAngle, float endAngle, int segments)
+{
+    CircleArc arc = { 0 };
+    float sweep = endAngle - startAngle;
+
+    arc.startAngle = startAngle;
+    arc.stepLength = (segments > 0)? sweep/(float)segments : 0.0f;
+
+    if ((segments > 0) && (segments <= CIRCLE_CACHE_MAX_SEGMENTS))
+    {
+        CircleArcPoints *entry = NULL;
+
+        for (int i = 0; i < CIRCLE_CACHE_ARCS; i++)
+        {
+            if ((circleCache[i].segments == segments) && (circleCache[i].sweep == sweep))
+            {
+                entry = &circleCache[i];
+                break;
+            }
+        }
+
+        if (entry == NULL)
+        {
+            // Replace cache entries in order
+            entry = &circleCache[circleCacheNext];
+            circleCacheNext = (circleCacheNext + 1)%CIRCLE_CACHE_ARCS;
+
+            entry->segments = segments;
+            entry->sweep = sweep;
+
+            for (int i = 0; i <= segments; i++)
+            {
+                entry->points[2*i] = cosf(DEG2RAD*(arc.stepLength*i));
+                entry->points[2*i + 1] = sinf(DEG2RAD*(arc.stepLength*i));
+            }
+        }
+
+        arc.points = entry->points;
+        arc.cosStart = cosf(DEG2RAD*startAngle);
+        arc.sinStart = sinf(DEG2RAD*startAngle);
+    }
+
+    return arc;
+}
+
+// Get circle arc unit circle point, index in [0..segments]
+static Vector2 GetCircleArcPoint(const CircleArc *arc, int index)
+{
+    Vector2 point = { 0 };
+
+    if (arc->points != NULL)
+    {
+        // Rotate cached point to the arc start angle
+        float x = arc->points[2*index];
+        float y = arc->points[2*index + 1];
+
+        point.x = x*arc->cosStart - y*arc->sinStart;
+        point.y = x*arc->sinStart + y*arc->cosStart;
+    }
+    else
+    {
+        float angle = DEG2RAD*(arc->startAngle + arc->stepLength*index);
+
+        point.x = cosf(angle);
+        point.y = sinf(angle);
+    }
+
+    return point;
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
@@ -0,0 +1,122 @@
+#ifndef ASTEROIDSIM_H
+#define ASTEROIDSIM_H
+
+#include "raylib.h"
+#include "SimChecksum.h"
+#include <random>
+#include <vector>
+
+// Simulation core of check.cpp (Asteroid Avoider): the player dodges asteroids that
+// drift in from the right. Asteroids are placed with the sim's own seeded generator, so
+// a run is reproducible from its seed and input. One Step() per frame.
+
+// Structs for the player and asteroids
+struct Player {
+    Vector2 position;
+    float radius;
+    Color color;
+};
+
+struct Asteroid {
+    Vector2 position;
+    float radius;
+    Color color;
+    Vector2 speed;
+};
+
+// The keys the game reads
+struct AsteroidInput {
+    bool up;       // W
+    bool down;     // S
+    bool restart;  // Enter, on the game over screen
+};
+
+class AsteroidSim {
+public:
+    static constexpr int asteroidSpeed = 4;
+    static constexpr int playerSpeed = 5;
+
+    AsteroidSim(int width, int height, int asteroidCount, unsigned seed)
+        : width(width), height(height), rng(seed) {
+        // Initialize player
+        player = { { 50, static_cast<float>(height / 2) }, 20, SKYBLUE };
+
+        // Initialize asteroids
+        asteroids.resize(asteroidCount);
+        for (auto &asteroid : asteroids) {
+            asteroid = { { 0, 0 }, 30.0f, DARKGRAY, { 0, 0 } };
+            ResetAsteroid(asteroid);
+        }
+    }
+
+    void Step(const AsteroidInput& input) {
+        if (!gameOver) {
+            // Player movement
+            if (input.up && player.position.y > player.radius) player.position.y -= playerSpeed;
+            if (input.down && player.position.y < height - player.radius) player.position.y += playerSpeed;
+
+            // Update asteroids
+            for (auto &asteroid : asteroids) {
+                asteroid.position.x += asteroid.speed.x;
+                asteroid.position.y += asteroid.speed.y;
+
+                // Wrap asteroid vertically
+                if (asteroid.position.y > height || asteroid.position.y < 0) {
+                    asteroid.speed.y = -asteroid.speed.y;
+                }
+
+                // Reset position if off-screen
+                if (asteroid.position.x < -asteroid.radius) {
+                    score++;
+                    ResetAsteroid(asteroid);
+                }
+
+                // Collision detection
+                if (CheckCollisionCircles(player.position, player.radius, asteroid.position, asteroid.radius)) {
+                    gameOver = true;
+                }
+            }
+        } else if (input.restart) {
+            gameOver = false;
+            score = 0;
+            player.position = { 50, static_cast<float>(height / 2) };
+            for (auto &asteroid : asteroids) {
+                ResetAsteroid(asteroid);
+            }
+        }
+    }
+
+    uint64_t Checksum() const {
+        SimChecksum sum;
+        sum.Add(player.position);
+        for (const auto &asteroid : asteroids) {
+            sum.Add(asteroid.position);
+            sum.Add(asteroid.speed);
+        }
+        sum.Add(score);
+        sum.Add(gameOver);
+        return sum.hash;
+    }
+
+    int width, height;
+    Player player;
+    std::vector<Asteroid> asteroids;
+    int score = 0;
+    bool gameOver = false;
+
+private:
+    // Uniform integer in [0, n)
+    int Random(int n) { return static_cast<int>(rng() % static_cast<unsigned>(n)); }
+
+    // Helper function to reset an asteroid's position
+    void ResetAsteroid(Asteroid &asteroid) {
+        asteroid.position.x = width + Random(200);
+        asteroid.position.y = Random(height);
+        asteroid.speed.x = -(asteroidSpeed + Random(3));
+        asteroid.speed.y = Random(5) - 2;
+    }
+
+    std::mt19937 rng;
+};
+
+#endif // ASTEROIDSIM_H
@@ -0,0 +1,294 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include "raylib.h"
+#include "NeighborGrid.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// 2D broadphase: finds every pair of bodies whose axis-aligned bounding boxes overlap,
+// as one batch of index pairs. The exact shape test is left to a narrowphase pass over
+// that batch, typically raylib's CheckCollisionCircles/CheckCollisionRecs/
+// CheckCollisionCircleRec (see NarrowPhase() below):
+//
+//     broadphase.FindPairs(count, [&](int i) { return Rectangle{ ... }; }, pairs);
+//     NarrowPhase(pairs, [&](int a, int b) { return CheckCollisionCircles(c[a], r[a], c[b], r[b]); });
+//
+// Bounds are read through an accessor `Rectangle bounds(int i)`, like NeighborGrid's
+// positions, so any body layout works. Pairs come out with a < b, each pair once.
+// Touching boxes count as overlapping; the narrowphase decides.
+//
+// Two methods:
+// - Sweep and prune sorts the boxes along x and sweeps: each box is only tested against
+//   the boxes that start before it ends. The sort order is kept between calls, so for
+//   bodies that move a little per frame the insertion sort is close to linear. Handles
+//   any mix of body sizes.
+// - The uniform grid buckets box centers into cells as large as the biggest box, so only
+//   boxes in neighboring cells can overlap. Best for many bodies of similar size; a few
+//   outsized boxes are kept out of the cells and tested on their own.
+
+struct CollisionPair {
+    int a, b;
+};
+
+enum BroadphaseMethod {
+    BROADPHASE_SWEEP_AND_PRUNE = 0,
+    BROADPHASE_GRID
+};
+
+// Keep only the pairs for which overlap(a, b) is true, in place and in order
+template <typename Overlap>
+void NarrowPhase(std::vector<CollisionPair>& pairs, Overlap overlap) {
+    size_t kept = 0;
+    for (const CollisionPair& p : pairs) {
+        if (overlap(p.a, p.b)) pairs[kept++] = p;
+    }
+    pairs.resize(kept);
+}
+
+// Boxes gathered into sorted order as separate arrays, so the sweeps stream through them
+struct SortedBounds {
+    std::vector<float> minX, maxX, minY, maxY;
+    std::vector<int> body;
+
+    void Resize(int count) {
+        minX.resize(count); maxX.resize(count);
+        minY.resize(count); maxY.resize(count);
+        body.resize(count);
+    }
+
+    void Set(int k, int i, Rectangle r) {
+        minX[k] = r.x; maxX[k] = r.x + r.width;
+        minY[k] = r.y; maxY[k] = r.y + r.height;
+        body[k] = i;
+    }
+
+    // Test box k against boxes [begin, end), which must all overlap it along x. Every
+    // candidate is written and the count only advances on a y overlap, so there is no
+    // branch to mispredict; `pairs` must have room for end - begin more entries.
+    int AppendOverlapsY(int k, int begin, int end, CollisionPair* pairs, int n) const {
+        int a = body[k];
+        float lo = minY[k], hi = maxY[k];
+        for (int m = begin; m < end; m++) {
+            int b = body[m];
+            pairs[n] = { std::min(a, b), std::max(a, b) };
+            n += (minY[m] <= hi) & (maxY[m] >= lo);
+        }
+        return n;
+    }
+
+    // Same, but boxes [begin, end) may not overlap box k along x
+    int AppendOverlaps(int k, int begin, int end, CollisionPair* pairs, int n) const {
+        int a = body[k];
+        float x0 = minX[k], x1 = maxX[k], y0 = minY[k], y1 = maxY[k];
+        for (int m = begin; m < end; m++) {
+            int b = body[m];
+            pairs[n] = { std::min(a, b), std::max(a, b) };
+            n += (minX[m] <= x1) & (maxX[m] >= x0) & (minY[m] <= y1) & (maxY[m] >= y0);
+        }
+        return n;
+    }
+};
+
+// Grow `pairs` so that `needed` entries fit, keeping the first n
+inline CollisionPair* EnsurePairCapacity(std::vector<CollisionPair>& pairs, int needed) {
+    if (needed > static_cast<int>(pairs.size())) pairs.resize(std::max(needed, 2 * static_cast<int>(pairs.size())));
+    return pairs.data();
+}
+
+class SweepAndPrune {
+public:
+    template <typename BoundsFn>
+    void FindPairs(int count, BoundsFn bounds, std::vector<CollisionPair>& pairs) {
+        // Sort body indices by the left edge of their box. After the first call the order
+        // from the previous call is nearly right, and insertion sort fixes it in ~O(n).
+        minX.resize(count);
+        for (int i = 0; i < count; i++) minX[i] = bounds(i).x;
+        if (static_cast<int>(order.size()) != count) {
+            order.resize(count);
+            for (int i = 0; i < count; i++) order[i] = i;
+            std::sort(order.begin(), order.end(), [&](int a, int b) { return minX[a] < minX[b]; });
+        } else {
+            for (int k = 1; k < count; k++) {
+                int i = order[k];
+                float x = minX[i];
+                int m = k;
+                for (; m > 0 && minX[order[m - 1]] > x; m--) order[m] = order[m - 1];
+                order[m] = i;
+            }
+        }
+
+        sorted.Resize(count);
+        for (int k = 0; k < count; k++) sorted.Set(k, order[k], bounds(order[k]));
+
+        // Sweep: the boxes overlapping box k along x are the ones after it that start
+        // before it ends
+        int n = 0;
+        for (int k = 0; k < count; k++) {
+            float right = sorted.maxX[k];
+            int end = k + 1;
+            while (end < count && sorted.minX[end] <= right) end++;
+            CollisionPair* out = EnsurePairCapacity(pairs, n + (end - k - 1));
+            n = sorted.AppendOverlapsY(k, k + 1, end, out, n);
+        }
+        pairs.resize(n);
+    }
+
+private:
+    std::vector<int> order;   // Body indices sorted by minX, kept between calls
+    std::vector<float> minX;  // Per body, for sorting
+    SortedBounds sorted;
+};
+
+class GridBroadphase {
+public:
+    // Boxes larger than this many times the mean box size do not set the cell size
+    static constexpr float largeBoxFactor = 4.0f;
+
+    template <typename BoundsFn>
+    void FindPairs(int count, BoundsFn bounds, std::vector<CollisionPair>& pairs) {
+        pairs.clear();
+        if (count == 0) return;
+
+        // Fit the grid to the bodies. With cells at least as large as a box, two overlapping
+        // boxes have their centers in the same or in adjacent cells. Cells are also kept
+        // large enough that there are no more of them than about 2 per body.
+        Rectangle first = bounds(0);
+        float x0 = first.x, y0 = first.y, x1 = first.x + first.width, y1 = first.y + first.height;
+        float extentSum = 0.0f;
+        extents.resize(count);
+        for (int i = 0; i < count; i++) {
+            Rectangle r = bounds(i);
+            x0 = std::min(x0, r.x); x1 = std::max(x1, r.x + r.width);
+            y0 = std::min(y0, r.y); y1 = std::max(y1, r.y + r.height);
+            extents[i] = std::max(r.width, r.height);
+            extentSum += extents[i];
+        }
+
+        // A few outsized boxes would blow the cells up until every body shares one, so they
+        // stay out of the grid: each one queries the cells it covers, and they are paired
+        // with each other by sweep and prune. When more than one body in largeBodyLimit is
+        // large the grid has nothing left to win and the whole set goes through sweep and prune.
+        float largeExtent = largeBoxFactor * extentSum / count;
+        float extent = 0.0f;
+        smallBody.clear();
+        largeBody.clear();
+        for (int i = 0; i < count; i++) {
+            if (extents[i] > largeExtent) {
+                largeBody.push_back(i);
+            } else {
+                smallBody.push_back(i);
+                extent = std::max(extent, extents[i]);
+            }
+        }
+        if (static_cast<int>(largeBody.size()) * largeBodyLimit > count) {
+            sweep.FindPairs(count, bounds, pairs);
+            return;
+        }
+
+        int smallCount = static_cast<int>(smallBody.size());
+        Rectangle world = { x0, y0, x1 - x0, y1 - y0 };
+        float cellSize = std::max(extent, std::sqrt(world.width * world.height / (2.0f * count)));
+        cellSize = std::max(cellSize, 1e-3f);
+        grid.Configure(world, cellSize);
+        centers.resize(smallCount);
+        for (int k = 0; k < smallCount; k++) {
+            Rectangle r = bounds(smallBody[k]);
+            centers[k] = { r.x + r.width / 2, r.y + r.height / 2 };
+        }
+        grid.Rebuild(smallCount, [&](int k) { return centers[k]; });
+
+        // Small boxes in grid order, then the large ones
+        sorted.Resize(count);
+        for (int k = 0; k < smallCount; k++) {
+            int i = smallBody[grid.sortedIndex[k]];
+            sorted.Set(k, i, bounds(i));
+        }
+        for (int k = smallCount; k < count; k++) sorted.Set(k, largeBody[k - smallCount], bounds(largeBody[k - smallCount]));
+
+        // Each cell against itself and its forward neighbors (E, SW, S, SE), as in
+        // NeighborGrid::ForEachPair(), so no pair is found twice. A cell and its east
+        // neighbor are adjacent in sorted order, and so are the three cells below it,
+        // so that is two contiguous spans per box.
+        int cols = grid.Cols(), rows = grid.Rows();
+        const std::vector<int>& cellStart = grid.cellStart;
+        int n = 0;
+        for (int cy = 0; cy < rows; cy++) {
+            for (int cx = 0; cx < cols; cx++) {
+                int c = cy * cols + cx;
+                int begin = cellStart[c], end = cellStart[c + 1];
+                if (begin == end) continue;
+
+                int sameEnd = cellStart[c + ((cx + 1 < cols) ? 2 : 1)];
+                int below = (cy + 1) * cols;
+                int belowBegin = 0, belowEnd = 0;
+                if (cy + 1 < rows) {
+                    belowBegin = cellStart[below + std::max(cx - 1, 0)];
+                    belowEnd = cellStart[below + std::min(cx + 1, cols - 1) + 1];
+                }
+
+                for (int k = begin; k < end; k++) {
+                    CollisionPair* out = EnsurePairCapacity(pairs, n + (sameEnd - k - 1) + (belowEnd - belowBegin));
+                    n = sorted.AppendOverlaps(k, k + 1, sameEnd, out, n);
+                    n = sorted.AppendOverlaps(k, belowBegin, belowEnd, out, n);
+                }
+            }
+        }
+
+        // Large boxes against the small ones: a small box overlapping a large one has its
+        // center within half a cell of it, so only the cells under the grown box are read
+        float margin = cellSize / 2;
+        for (int k = smallCount; k < count; k++) {
+            int cx0 = grid.CellX(sorted.minX[k] - margin), cx1 = grid.CellX(sorted.maxX[k] + margin);
+            int cy0 = grid.CellY(sorted.minY[k] - margin), cy1 = grid.CellY(sorted.maxY[k] + margin);
+            for (int cy = cy0; cy <= cy1; cy++) {
+                int begin = cellStart[cy * cols + cx0], end = cellStart[cy * cols + cx1 + 1];
+                CollisionPair* out = EnsurePairCapacity(pairs, n + (end - begin));
+                n = sorted.AppendOverlaps(k, begin, end, out, n);
+            }
+        }
+
+        // Large boxes against each other
+        if (!largeBody.empty()) {
+            sweep.FindPairs(static_cast<int>(largeBody.size()), [&](int j) { return bounds(largeBody[j]); }, largePairs);
+            CollisionPair* out = EnsurePairCapacity(pairs, n + static_cast<int>(largePairs.size()));
+            for (const CollisionPair& p : largePairs) {
+                int a = largeBody[p.a], b = largeBody[p.b];
+                out[n++] = { std::min(a, b), std::max(a, b) };
+            }
+        }
+        pairs.resize(n);
+    }
+
+private:
+    static constexpr int largeBodyLimit = 8;  // At most count/largeBodyLimit boxes kept out of the grid
+
+    NeighborGrid grid;
+    std::vector<Vector2> centers;      // Per small box
+    std::vector<float> extents;        // Per body, larger box side
+    std::vector<int> smallBody, largeBody;
+    std::vector<CollisionPair> largePairs;
+    SweepAndPrune sweep;               // Large boxes, or every box when too many are large
+    SortedBounds sorted;
+};
+
+// Either method behind one interface, switchable at runtime
+class Broadphase {
+public:
+    explicit Broadphase(BroadphaseMethod method = BROADPHASE_SWEEP_AND_PRUNE) : method(method) {}
+
+    template <typename BoundsFn>
+    void FindPairs(int count, BoundsFn bounds, std::vector<CollisionPair>& pairs) {
+        if (method == BROADPHASE_GRID) grid.FindPairs(count, bounds, pairs);
+        else sweep.FindPairs(count, bounds, pairs);
+    }
+
+    BroadphaseMethod method;
+
+private:
+    SweepAndPrune sweep;
+    GridBroadphase grid;
+};
+
+#endif // BROADPHASE_H
@@ -0,0 +1,59 @@
+#ifndef CROSSVALIDATION_H
+#define CROSSVALIDATION_H
+
+#include "CsvLoader.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+// K-fold split of a classification dataset (class index in the last column) as index
+// views: the rows are shuffled once by index and fold f is the f-th slice of that
+// order. Rows that do not fill a whole fold are left out.
+
+class KFold {
+public:
+    KFold(const DataMatrix& data, int folds, unsigned int seed) : data(&data), folds(folds) {
+        std::mt19937 rng(seed);
+        order.resize(data.rows);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rng);
+        foldSize = data.rows / folds;
+
+        std::set<float> labels;
+        for (int k = 0; k < folds * foldSize; k++) labels.insert(data.At(order[k], data.cols - 1));
+        classes = static_cast<int>(labels.size());
+    }
+
+    int Count() const { return folds; }
+    int FoldSize() const { return foldSize; }
+    int Classes() const { return classes; }   // Distinct labels in the folds
+    int Inputs() const { return data->cols - 1; }
+
+    DataView Test(int f) const {
+        return DataView{ data, order.data() + f * foldSize, foldSize };
+    }
+
+    // Indices of every fold but f, in fold order; wrap them with View()
+    std::vector<int> TrainRows(int f) const {
+        std::vector<int> rows;
+        rows.reserve((folds - 1) * foldSize);
+        rows.insert(rows.end(), order.begin(), order.begin() + f * foldSize);
+        rows.insert(rows.end(), order.begin() + (f + 1) * foldSize, order.begin() + folds * foldSize);
+        return rows;
+    }
+
+    DataView View(const std::vector<int>& rows, int begin, int end) const {
+        return DataView{ data, rows.data() + begin, end - begin };
+    }
+
+private:
+    const DataMatrix* data;
+    int folds;
+    int foldSize;
+    int classes;
+    std::vector<int> order;
+};
+
+#endif // CROSSVALIDATION_H
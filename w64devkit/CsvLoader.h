@@ -0,0 +1,166 @@
+#ifndef CSVLOADER_H
+#define CSVLOADER_H
+
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Numeric CSV files into one row-major float matrix. The file is memory mapped and
+// parsed in a single front-to-back pass with a hand-written number parser, keeping the
+// per-column minimum and maximum as it goes, so the only allocation is the matrix itself.
+//
+// Accepted: comma-separated decimal numbers with optional sign, fraction and exponent,
+// spaces around fields, LF or CRLF line ends, blank lines. Every row needs the same
+// number of fields as the first one.
+
+struct DataMatrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<float> values; // rows * cols, row-major
+
+    float* Row(int r) { return values.data() + static_cast<size_t>(r) * cols; }
+    const float* Row(int r) const { return values.data() + static_cast<size_t>(r) * cols; }
+    float& At(int r, int c) { return values[static_cast<size_t>(r) * cols + c]; }
+    float At(int r, int c) const { return values[static_cast<size_t>(r) * cols + c]; }
+};
+
+// A subset of a matrix's rows, in any order, by index: folds and shuffles of a dataset
+// without copying its rows
+struct DataView {
+    const DataMatrix* data = nullptr;
+    const int* rows = nullptr;
+    int count = 0;
+
+    const float* Row(int k) const { return data->Row(rows[k]); }
+    float Label(int k) const { return data->Row(rows[k])[data->cols - 1]; } // Last column
+};
+
+// Parse one number starting at p, moving p past it. False if there is no number there.
+// Up to 19 significant digits are gathered into an integer and scaled once in double
+// precision, which is exact to well within a float's precision.
+inline bool ParseCsvFloat(const char*& p, const char* end, float& out) {
+    static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                      1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+')) negative = (*s++ == '-');
+
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool any = false;
+    for (; s < end && static_cast<unsigned>(*s - '0') < 10; s++, any = true) {
+        if (digits < 19) { mantissa = mantissa * 10 + (*s - '0'); digits += (mantissa != 0); }
+        else exponent++;
+    }
+    if (s < end && *s == '.') {
+        for (s++; s < end && static_cast<unsigned>(*s - '0') < 10; s++, any = true) {
+            if (digits < 19) { mantissa = mantissa * 10 + (*s - '0'); digits += (mantissa != 0); exponent--; }
+        }
+    }
+    if (!any) return false;
+
+    if (s < end && (*s == 'e' || *s == 'E')) {
+        const char* e = s + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+')) negativeExponent = (*e++ == '-');
+        if (e < end && static_cast<unsigned>(*e - '0') < 10) {
+            int value = 0;
+            for (; e < end && static_cast<unsigned>(*e - '0') < 10; e++) value = std::min(value * 10 + (*e - '0'), 100000);
+            exponent += negativeExponent ? -value : value;
+            s = e;
+        }
+    }
+
+    double v = static_cast<double>(mantissa);
+    if (v != 0.0) {
+        while (exponent > 22) { v *= 1e22; exponent -= 22; }
+        while (exponent < -22) { v /= 1e22; exponent += 22; }
+        v = (exponent >= 0) ? v * powers[exponent] : v / powers[-exponent];
+    }
+    out = static_cast<float>(negative ? -v : v);
+    p = s;
+    return true;
+}
+
+// Load `path` into `matrix`, and the smallest and largest value of each column into
+// mins/maxs. On failure returns false with a message in `error` (if given).
+inline bool LoadCsv(const char* path, DataMatrix& matrix, std::vector<float>& mins, std::vector<float>& maxs,
+                    std::string* error = nullptr) {
+    auto fail = [&](const std::string& message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    MappedFile file(path);
+    if (!file.IsOpen()) return fail(std::string("cannot open ") + path);
+
+    matrix.rows = matrix.cols = 0;
+    matrix.values.clear();
+    mins.clear();
+    maxs.clear();
+
+    const char* p = file.Data();
+    const char* end = p + file.Size();
+    int line = 0;
+    while (p < end) {
+        line++;
+        // Skip blank lines
+        const char* q = p;
+        while (q < end && (*q == ' ' || *q == '\t' || *q == '\r')) q++;
+        if (q == end) break;
+        if (*q == '\n') { p = q + 1; continue; }
+
+        int col = 0;
+        for (;;) {
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            float v;
+            if (!ParseCsvFloat(p, end, v)) return fail("line " + std::to_string(line) + ": expected a number");
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+
+            if (matrix.rows == 0) {
+                mins.push_back(v);
+                maxs.push_back(v);
+            } else if (col >= matrix.cols) {
+                return fail("line " + std::to_string(line) + ": more than " + std::to_string(matrix.cols) + " fields");
+            } else {
+                mins[col] = std::min(mins[col], v);
+                maxs[col] = std::max(maxs[col], v);
+            }
+            matrix.values.push_back(v);
+            col++;
+
+            if (p < end && *p == ',') { p++; continue; }
+            if (p < end && *p == '\r') p++;
+            if (p < end && *p != '\n') return fail("line " + std::to_string(line) + ": unexpected character");
+            p++;
+            break;
+        }
+
+        if (matrix.rows == 0) {
+            // Now that the row length is known, guess the row count from the file size
+            matrix.cols = col;
+            size_t lineBytes = static_cast<size_t>(p - file.Data());
+            matrix.values.reserve(file.Size() / std::max<size_t>(lineBytes, 1) * col + col);
+        } else if (col != matrix.cols) {
+            return fail("line " + std::to_string(line) + ": " + std::to_string(col) + " fields, expected " + std::to_string(matrix.cols));
+        }
+        matrix.rows++;
+    }
+    return true;
+}
+
+// Scale columns [0, count) to 0..1 with the ranges LoadCsv() found. Constant columns
+// become 0.
+inline void NormalizeColumns(DataMatrix& matrix, const std::vector<float>& mins, const std::vector<float>& maxs, int count) {
+    std::vector<float> scale(count);
+    for (int c = 0; c < count; c++) scale[c] = (maxs[c] > mins[c]) ? 1.0f / (maxs[c] - mins[c]) : 0.0f;
+    for (int r = 0; r < matrix.rows; r++) {
+        float* row = matrix.Row(r);
+        for (int c = 0; c < count; c++) row[c] = (row[c] - mins[c]) * scale[c];
+    }
+}
+
+#endif // CSVLOADER_H
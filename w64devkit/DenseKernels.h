@@ -0,0 +1,265 @@
+#ifndef DENSEKERNELS_H
+#define DENSEKERNELS_H
+
+#include "ParticleKernels.h"
+#include <algorithm>
+
+// Matrix and activation kernels for DenseNetwork, in scalar and AVX2 flavors with the
+// same runtime dispatch as ParticleKernels.
+//
+// Matrices are row-major. Every row that is written (and every row of B) holds a whole
+// number of AVX registers: n and the leading dimensions ldb/ldc must be multiples of 8
+// and the rows aligned to 32 bytes. A is read through separate row and column strides,
+// so a transposed A costs nothing.
+
+enum Activation {
+    ACTIVATION_LINEAR = 0,
+    ACTIVATION_SIGMOID,
+    ACTIVATION_TANH,
+    ACTIVATION_RELU
+};
+
+const int denseLanes = 8;        // Floats per AVX register
+const int denseDepthBlock = 256; // Rows of B per pass, so a 16-column panel of B stays in L1
+
+inline int PadDenseWidth(int n) {
+    return (n + denseLanes - 1) / denseLanes * denseLanes;
+}
+
+// tanh from its [7/6] Pade approximant clamped to [-1, 1], within 1e-4 everywhere.
+// Sigmoid is a shifted and scaled tanh. No exp(), so both vectorize.
+inline float FastTanh(float x) {
+    x = std::min(std::max(x, -9.0f), 9.0f);
+    float x2 = x * x;
+    float p = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    float q = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    return std::min(std::max(p / q, -1.0f), 1.0f);
+}
+
+inline float FastSigmoid(float x) {
+    return 0.5f + 0.5f * FastTanh(0.5f * x);
+}
+
+//----------------------------------------------------------------------------------
+// Scalar kernels. Loops are laid out so the compiler can vectorize them on its own.
+//----------------------------------------------------------------------------------
+
+// C[m x n] += A[m x k] * B[k x n], with A(i, p) = a[i * aRow + p * aCol]. Rows of C
+// are updated two at a time so each B element loaded is used twice.
+static inline void MatMulAddScalar(const float* a, int aRow, int aCol, const float* b, int ldb,
+                                   float* c, int ldc, int m, int n, int k) {
+    for (int p0 = 0; p0 < k; p0 += denseDepthBlock) {
+        int p1 = std::min(p0 + denseDepthBlock, k);
+        int i = 0;
+        for (; i + 2 <= m; i += 2) {
+            float* __restrict row0 = c + i * ldc;
+            float* __restrict row1 = row0 + ldc;
+            for (int p = p0; p < p1; p++) {
+                float s0 = a[i * aRow + p * aCol], s1 = a[(i + 1) * aRow + p * aCol];
+                const float* __restrict bRow = b + p * ldb;
+                for (int j = 0; j < n; j++) {
+                    row0[j] += s0 * bRow[j];
+                    row1[j] += s1 * bRow[j];
+                }
+            }
+        }
+        for (; i < m; i++) {
+            float* __restrict row = c + i * ldc;
+            for (int p = p0; p < p1; p++) {
+                float s = a[i * aRow + p * aCol];
+                const float* __restrict bRow = b + p * ldb;
+                for (int j = 0; j < n; j++) row[j] += s * bRow[j];
+            }
+        }
+    }
+}
+
+static inline void ActivateScalar(float* x, int n, Activation f) {
+    switch (f) {
+        case ACTIVATION_SIGMOID: for (int i = 0; i < n; i++) x[i] = FastSigmoid(x[i]); break;
+        case ACTIVATION_TANH: for (int i = 0; i < n; i++) x[i] = FastTanh(x[i]); break;
+        case ACTIVATION_RELU: for (int i = 0; i < n; i++) x[i] = std::max(x[i], 0.0f); break;
+        default: break;
+    }
+}
+
+// delta *= f'(z), written in terms of the activation's output y = f(z)
+static inline void ActivationGradScalar(const float* y, float* delta, int n, Activation f) {
+    switch (f) {
+        case ACTIVATION_SIGMOID: for (int i = 0; i < n; i++) delta[i] *= y[i] * (1.0f - y[i]); break;
+        case ACTIVATION_TANH: for (int i = 0; i < n; i++) delta[i] *= 1.0f - y[i] * y[i]; break;
+        case ACTIVATION_RELU: for (int i = 0; i < n; i++) delta[i] = (y[i] > 0.0f) ? delta[i] : 0.0f; break;
+        default: break;
+    }
+}
+
+// y += s * x
+static inline void AxpyScalar(float* y, const float* x, float s, int n) {
+    for (int i = 0; i < n; i++) y[i] += s * x[i];
+}
+
+#if defined(PARTICLE_KERNELS_X86)
+//----------------------------------------------------------------------------------
+// AVX2/FMA kernels. The matrix product works on 4x16 tiles of C held in eight
+// registers: each step loads two registers of a B row and broadcasts four A values.
+//----------------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static inline void MatMulAddAVX2(const float* a, int aRow, int aCol, const float* b, int ldb,
+                                 float* c, int ldc, int m, int n, int k) {
+    for (int p0 = 0; p0 < k; p0 += denseDepthBlock) {
+        int p1 = std::min(p0 + denseDepthBlock, k);
+        int j = 0;
+        for (; j + 16 <= n; j += 16) {
+            int i = 0;
+            for (; i + 4 <= m; i += 4) {
+                const float* a0 = a + i * aRow;
+                float* c0 = c + i * ldc + j;
+                __m256 c00 = _mm256_load_ps(c0), c01 = _mm256_load_ps(c0 + 8);
+                __m256 c10 = _mm256_load_ps(c0 + ldc), c11 = _mm256_load_ps(c0 + ldc + 8);
+                __m256 c20 = _mm256_load_ps(c0 + 2 * ldc), c21 = _mm256_load_ps(c0 + 2 * ldc + 8);
+                __m256 c30 = _mm256_load_ps(c0 + 3 * ldc), c31 = _mm256_load_ps(c0 + 3 * ldc + 8);
+                for (int p = p0; p < p1; p++) {
+                    const float* bRow = b + p * ldb + j;
+                    __m256 b0 = _mm256_load_ps(bRow), b1 = _mm256_load_ps(bRow + 8);
+                    const float* ap = a0 + p * aCol;
+                    __m256 s = _mm256_broadcast_ss(ap);
+                    c00 = _mm256_fmadd_ps(s, b0, c00); c01 = _mm256_fmadd_ps(s, b1, c01);
+                    s = _mm256_broadcast_ss(ap + aRow);
+                    c10 = _mm256_fmadd_ps(s, b0, c10); c11 = _mm256_fmadd_ps(s, b1, c11);
+                    s = _mm256_broadcast_ss(ap + 2 * aRow);
+                    c20 = _mm256_fmadd_ps(s, b0, c20); c21 = _mm256_fmadd_ps(s, b1, c21);
+                    s = _mm256_broadcast_ss(ap + 3 * aRow);
+                    c30 = _mm256_fmadd_ps(s, b0, c30); c31 = _mm256_fmadd_ps(s, b1, c31);
+                }
+                _mm256_store_ps(c0, c00); _mm256_store_ps(c0 + 8, c01);
+                _mm256_store_ps(c0 + ldc, c10); _mm256_store_ps(c0 + ldc + 8, c11);
+                _mm256_store_ps(c0 + 2 * ldc, c20); _mm256_store_ps(c0 + 2 * ldc + 8, c21);
+                _mm256_store_ps(c0 + 3 * ldc, c30); _mm256_store_ps(c0 + 3 * ldc + 8, c31);
+            }
+            for (; i < m; i++) {
+                float* c0 = c + i * ldc + j;
+                __m256 c00 = _mm256_load_ps(c0), c01 = _mm256_load_ps(c0 + 8);
+                for (int p = p0; p < p1; p++) {
+                    __m256 s = _mm256_broadcast_ss(a + i * aRow + p * aCol);
+                    c00 = _mm256_fmadd_ps(s, _mm256_load_ps(b + p * ldb + j), c00);
+                    c01 = _mm256_fmadd_ps(s, _mm256_load_ps(b + p * ldb + j + 8), c01);
+                }
+                _mm256_store_ps(c0, c00); _mm256_store_ps(c0 + 8, c01);
+            }
+        }
+        // Last 8 columns, when n is not a multiple of 16: 4x8 tiles
+        for (; j < n; j += 8) {
+            int i = 0;
+            for (; i + 4 <= m; i += 4) {
+                float* c0 = c + i * ldc + j;
+                __m256 c00 = _mm256_load_ps(c0), c10 = _mm256_load_ps(c0 + ldc);
+                __m256 c20 = _mm256_load_ps(c0 + 2 * ldc), c30 = _mm256_load_ps(c0 + 3 * ldc);
+                for (int p = p0; p < p1; p++) {
+                    __m256 b0 = _mm256_load_ps(b + p * ldb + j);
+                    const float* ap = a + i * aRow + p * aCol;
+                    c00 = _mm256_fmadd_ps(_mm256_broadcast_ss(ap), b0, c00);
+                    c10 = _mm256_fmadd_ps(_mm256_broadcast_ss(ap + aRow), b0, c10);
+                    c20 = _mm256_fmadd_ps(_mm256_broadcast_ss(ap + 2 * aRow), b0, c20);
+                    c30 = _mm256_fmadd_ps(_mm256_broadcast_ss(ap + 3 * aRow), b0, c30);
+                }
+                _mm256_store_ps(c0, c00); _mm256_store_ps(c0 + ldc, c10);
+                _mm256_store_ps(c0 + 2 * ldc, c20); _mm256_store_ps(c0 + 3 * ldc, c30);
+            }
+            for (; i < m; i++) {
+                float* c0 = c + i * ldc + j;
+                __m256 c00 = _mm256_load_ps(c0);
+                for (int p = p0; p < p1; p++) {
+                    c00 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + i * aRow + p * aCol), _mm256_load_ps(b + p * ldb + j), c00);
+                }
+                _mm256_store_ps(c0, c00);
+            }
+        }
+    }
+}
+
+// FastTanh() on 8 lanes
+__attribute__((target("avx2,fma")))
+static inline __m256 FastTanhAVX2(__m256 x) {
+    const __m256 one = _mm256_set1_ps(1.0f), limit = _mm256_set1_ps(9.0f);
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_sub_ps(_mm256_setzero_ps(), limit)), limit);
+    __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_add_ps(x2, _mm256_set1_ps(378.0f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(17325.0f));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(135135.0f));
+    p = _mm256_mul_ps(p, x);
+    __m256 q = _mm256_fmadd_ps(x2, _mm256_set1_ps(28.0f), _mm256_set1_ps(3150.0f));
+    q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(62370.0f));
+    q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(135135.0f));
+    __m256 t = _mm256_div_ps(p, q);
+    return _mm256_min_ps(_mm256_max_ps(t, _mm256_sub_ps(_mm256_setzero_ps(), one)), one);
+}
+
+__attribute__((target("avx2,fma")))
+static inline void ActivateAVX2(float* x, int n, Activation f) {
+    const __m256 half = _mm256_set1_ps(0.5f), zero = _mm256_setzero_ps();
+    for (int i = 0; i < n; i += 8) {
+        __m256 v = _mm256_load_ps(x + i);
+        switch (f) {
+            case ACTIVATION_SIGMOID: v = _mm256_fmadd_ps(FastTanhAVX2(_mm256_mul_ps(v, half)), half, half); break;
+            case ACTIVATION_TANH: v = FastTanhAVX2(v); break;
+            case ACTIVATION_RELU: v = _mm256_max_ps(v, zero); break;
+            default: break;
+        }
+        _mm256_store_ps(x + i, v);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static inline void ActivationGradAVX2(const float* y, float* delta, int n, Activation f) {
+    const __m256 one = _mm256_set1_ps(1.0f), zero = _mm256_setzero_ps();
+    for (int i = 0; i < n; i += 8) {
+        __m256 v = _mm256_load_ps(y + i), d = _mm256_load_ps(delta + i);
+        switch (f) {
+            case ACTIVATION_SIGMOID: d = _mm256_mul_ps(d, _mm256_mul_ps(v, _mm256_sub_ps(one, v))); break;
+            case ACTIVATION_TANH: d = _mm256_mul_ps(d, _mm256_fnmadd_ps(v, v, one)); break;
+            case ACTIVATION_RELU: d = _mm256_and_ps(d, _mm256_cmp_ps(v, zero, _CMP_GT_OQ)); break;
+            default: break;
+        }
+        _mm256_store_ps(delta + i, d);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static inline void AxpyAVX2(float* y, const float* x, float s, int n) {
+    const __m256 scale = _mm256_set1_ps(s);
+    for (int i = 0; i < n; i += 8) {
+        _mm256_store_ps(y + i, _mm256_fmadd_ps(scale, _mm256_load_ps(x + i), _mm256_load_ps(y + i)));
+    }
+}
+#endif // PARTICLE_KERNELS_X86
+
+//----------------------------------------------------------------------------------
+// Runtime dispatch. There is no separate SSE2 set: the scalar loops already compile
+// to SSE2 on x86-64.
+//----------------------------------------------------------------------------------
+struct DenseKernels {
+    SimdLevel level;
+    void (*MatMulAdd)(const float* a, int aRow, int aCol, const float* b, int ldb, float* c, int ldc, int m, int n, int k);
+    void (*Activate)(float* x, int n, Activation f);
+    void (*ActivationGrad)(const float* y, float* delta, int n, Activation f);
+    void (*Axpy)(float* y, const float* x, float s, int n);
+
+    static DenseKernels For(SimdLevel level) {
+        level = std::min(level, ParticleKernels::Detect());
+#if defined(PARTICLE_KERNELS_X86)
+        if (level == SIMD_AVX2) return { SIMD_AVX2, MatMulAddAVX2, ActivateAVX2, ActivationGradAVX2, AxpyAVX2 };
+#endif
+        return { SIMD_SCALAR, MatMulAddScalar, ActivateScalar, ActivationGradScalar, AxpyScalar };
+    }
+
+    static const DenseKernels& Get() {
+        static const DenseKernels best = For(SIMD_AVX2);
+        return best;
+    }
+
+    static const char* Name(SimdLevel level) {
+        return (level == SIMD_AVX2) ? "AVX2" : "scalar";
+    }
+};
+
+#endif // DENSEKERNELS_H
@@ -0,0 +1,386 @@
+#ifndef DENSENETWORK_H
+#define DENSENETWORK_H
+
+#include "ParticleBuffer.h"
+#include "DenseKernels.h"
+#include "MappedFile.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstring>
+
+// Fully connected feed-forward network of any shape, trained with mini-batch gradient
+// descent on squared error. A whole batch goes through each layer as one matrix product
+// (see DenseKernels.h), so wide layers run at close to the CPU's FMA throughput instead
+// of one scalar multiply per weight and sample.
+//
+// Layout: layer l maps Size(l) inputs to Size(l + 1) outputs. Its weights are an
+// inputs x outputs matrix, row i holding the weights from input i, followed by one row
+// of biases; rows are padded to whole AVX registers. All layers share one contiguous
+// parameter array. Activations are stored per batch row with the same padding.
+//
+// Save() writes that array as is, behind a small header (see DenseCheckpointHeader).
+// Load() maps the file and runs Forward() straight from the mapped pages, so a process
+// that only does inference never reads or copies the weights up front. The first call
+// that changes the weights copies them into memory of the network's own.
+
+// Checkpoint file: this header, then one DenseCheckpointLayer per layer, then the
+// parameter array at dataOffset (a multiple of 64, so it is aligned when mapped). All
+// values little-endian, as written by x86.
+struct DenseCheckpointHeader {
+    char magic[8];            // "DENSENN" and a zero
+    uint32_t version;         // denseCheckpointVersion
+    uint32_t layerCount;
+    uint64_t dataOffset;      // Bytes from the start of the file to the parameters
+    uint64_t parameterCount;  // Floats, padding included
+    uint64_t progress;        // Caller-defined, e.g. epochs trained when saved
+    uint32_t reserved[6];
+};
+
+struct DenseCheckpointLayer {
+    uint32_t inputs, outputs;
+    uint32_t activation;
+    uint32_t reserved;
+};
+
+const uint32_t denseCheckpointVersion = 1;
+const int denseCheckpointAlignment = 64; // Bytes
+
+// Activation buffers for DenseNetwork::Forward(). A network has one of its own; threads
+// that run inference on the same network at once each need their own.
+class DenseWorkspace {
+private:
+    friend class DenseNetwork;
+    std::vector<AlignedArray<float>> activations; // Per layer output, batch rows
+    int capacity = 0;                             // Batch rows the buffers hold
+    const void* network = nullptr;                // Layout the buffers were sized for
+    int layoutVersion = -1;
+};
+
+class DenseNetwork {
+public:
+    DenseNetwork() = default;
+
+    DenseNetwork(const std::vector<int>& sizes, Activation hidden = ACTIVATION_SIGMOID,
+                 Activation output = ACTIVATION_SIGMOID, unsigned seed = 1) {
+        Initialize(sizes, hidden, output, seed);
+    }
+
+    // sizes = { inputs, hidden..., outputs }. Weights get a uniform Glorot initialization
+    // from the seed, biases start at zero.
+    void Initialize(const std::vector<int>& layerSizes, Activation hidden, Activation output, unsigned seed) {
+        std::vector<Activation> functions(layerSizes.size() - 1, hidden);
+        functions.back() = output;
+        SetLayout(layerSizes, functions);
+        parameters.Reserve(parameterCount);
+        memset(parameters.Data(), 0, sizeof(float) * parameterCount);
+        params = parameters.Data();
+        mapping.Close();
+
+        std::mt19937 rng(seed);
+        for (const Layer& layer : layers) {
+            float limit = std::sqrt(6.0f / (layer.inputs + layer.outputs));
+            std::uniform_real_distribution<float> weight(-limit, limit);
+            for (int i = 0; i < layer.inputs; i++) {
+                for (int o = 0; o < layer.outputs; o++) parameters[layer.weights + i * layer.stride + o] = weight(rng);
+            }
+        }
+    }
+
+    int LayerCount() const { return static_cast<int>(layers.size()); }
+    int Size(int l) const { return sizes[l]; } // Neurons in layer l, 0 being the inputs
+    int Inputs() const { return sizes.front(); }
+    int Outputs() const { return sizes.back(); }
+    int OutputStride() const { return layers.back().stride; } // Floats between output rows
+    Activation LayerActivation(int l) const { return layers[l].activation; }
+
+    // Weight from neuron i of layer l to neuron o of layer l + 1, and the bias of o
+    float& Weight(int l, int i, int o) { return Parameters()[layers[l].weights + i * layers[l].stride + o]; }
+    float Weight(int l, int i, int o) const { return params[layers[l].weights + i * layers[l].stride + o]; }
+    float& Bias(int l, int o) { return Weight(l, layers[l].inputs, o); }
+    float Bias(int l, int o) const { return Weight(l, layers[l].inputs, o); }
+
+    // Every weight and bias, padding included, as one block
+    float* Parameters() { Own(); return parameters.Data(); }
+    const float* Parameters() const { return params; }
+    int ParameterCount() const { return parameterCount; }
+
+    // True while the weights are read from a mapped checkpoint
+    bool Mapped() const { return params && params != parameters.Data(); }
+
+    // Write a checkpoint. Goes through a temporary file that replaces `path` only once
+    // complete, so it is safe to call in the middle of training and to kill the process
+    // at any time. `progress` is stored for the caller (see Progress()).
+    bool Save(const char* path, uint64_t progress = 0, std::string* error = nullptr) const {
+        DenseCheckpointHeader header = {};
+        memcpy(header.magic, "DENSENN", 8);
+        header.version = denseCheckpointVersion;
+        header.layerCount = static_cast<uint32_t>(layers.size());
+        header.dataOffset = CheckpointDataOffset(layers.size());
+        header.parameterCount = static_cast<uint64_t>(parameterCount);
+        header.progress = progress;
+
+        std::string temporary = std::string(path) + ".tmp";
+        FILE* file = fopen(temporary.c_str(), "wb");
+        if (!file) return CheckpointError(error, "cannot write " + temporary);
+        bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+        for (const Layer& layer : layers) {
+            DenseCheckpointLayer entry = { static_cast<uint32_t>(layer.inputs), static_cast<uint32_t>(layer.outputs),
+                                           static_cast<uint32_t>(layer.activation), 0 };
+            ok = ok && fwrite(&entry, sizeof(entry), 1, file) == 1;
+        }
+        static const char zeros[denseCheckpointAlignment] = {};
+        size_t written = sizeof(header) + layers.size() * sizeof(DenseCheckpointLayer);
+        ok = ok && fwrite(zeros, 1, header.dataOffset - written, file) == header.dataOffset - written;
+        ok = ok && fwrite(params, sizeof(float), parameterCount, file) == static_cast<size_t>(parameterCount);
+        ok = (fclose(file) == 0) && ok;
+        if (!ok) {
+            remove(temporary.c_str());
+            return CheckpointError(error, "cannot write " + temporary);
+        }
+        // Replace the old checkpoint in one step, so there is always a complete file at `path`
+#if defined(_WIN32)
+        bool replaced = MoveFileExA(temporary.c_str(), path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        bool replaced = rename(temporary.c_str(), path) == 0;
+#endif
+        if (!replaced) return CheckpointError(error, "cannot rename " + temporary + " to " + path);
+        return true;
+    }
+
+    // Map a checkpoint written by Save() and use its weights in place. On failure the
+    // network is left unchanged.
+    bool Load(const char* path, std::string* error = nullptr) {
+        MappedFile file(path);
+        if (!file.IsOpen()) return CheckpointError(error, std::string("cannot open ") + path);
+
+        DenseCheckpointHeader header;
+        if (file.Size() < sizeof(header)) return CheckpointError(error, "not a network checkpoint");
+        memcpy(&header, file.Data(), sizeof(header));
+        if (memcmp(header.magic, "DENSENN", 8) != 0) return CheckpointError(error, "not a network checkpoint");
+        if (header.version != denseCheckpointVersion) {
+            return CheckpointError(error, "checkpoint version " + std::to_string(header.version) + ", expected " +
+                                   std::to_string(denseCheckpointVersion));
+        }
+        if (header.layerCount == 0 || header.layerCount > 1024 ||
+            header.dataOffset != CheckpointDataOffset(header.layerCount)) return CheckpointError(error, "corrupt checkpoint header");
+        if (file.Size() < header.dataOffset) return CheckpointError(error, "checkpoint is truncated");
+
+        std::vector<int> shape;
+        std::vector<Activation> functions;
+        const char* table = file.Data() + sizeof(header);
+        for (uint32_t l = 0; l < header.layerCount; l++) {
+            DenseCheckpointLayer entry;
+            memcpy(&entry, table + l * sizeof(entry), sizeof(entry));
+            if (l == 0) shape.push_back(static_cast<int>(entry.inputs));
+            if (entry.inputs == 0 || entry.outputs == 0 || entry.inputs > (1u << 24) || entry.outputs > (1u << 24) ||
+                entry.activation > ACTIVATION_RELU || static_cast<int>(entry.inputs) != shape.back()) {
+                return CheckpointError(error, "corrupt layer table");
+            }
+            shape.push_back(static_cast<int>(entry.outputs));
+            functions.push_back(static_cast<Activation>(entry.activation));
+        }
+
+        // The parameter count must match the shapes, and the file must hold them all
+        uint64_t expected = 0;
+        for (uint32_t l = 0; l < header.layerCount; l++) expected += static_cast<uint64_t>(shape[l] + 1) * PadDenseWidth(shape[l + 1]);
+        if (header.parameterCount != expected || expected > 0x7fffffff) return CheckpointError(error, "corrupt checkpoint header");
+        if (file.Size() < header.dataOffset + expected * sizeof(float)) return CheckpointError(error, "checkpoint is truncated");
+
+        SetLayout(shape, functions);
+        mapping = std::move(file);
+        params = reinterpret_cast<const float*>(mapping.Data() + header.dataOffset);
+        progress = header.progress;
+        return true;
+    }
+
+    uint64_t Progress() const { return progress; } // As saved, for a loaded network
+
+    // Run `batch` samples through the network. Sample b starts at input + b * inputStride.
+    // Returns the outputs, OutputStride() floats per sample, valid until the next call.
+    const float* Forward(const float* input, int inputStride, int batch) {
+        return Forward(input, inputStride, batch, work);
+    }
+
+    // Same, with the caller's buffers; the outputs live in the workspace. Does not change
+    // the network, so threads with separate workspaces can call it at the same time.
+    const float* Forward(const float* input, int inputStride, int batch, DenseWorkspace& workspace) const {
+        Prepare(workspace, batch);
+        const float* x = input;
+        int xStride = inputStride;
+        for (size_t l = 0; l < layers.size(); l++) {
+            const Layer& layer = layers[l];
+            const float* w = params + layer.weights;
+            float* y = workspace.activations[l].Data();
+            for (int b = 0; b < batch; b++) memcpy(y + b * layer.stride, w + layer.inputs * layer.stride, sizeof(float) * layer.stride);
+            kernels.MatMulAdd(x, xStride, 1, w, layer.stride, y, layer.stride, batch, layer.stride, layer.inputs);
+            kernels.Activate(y, batch * layer.stride, layer.activation);
+            x = y;
+            xStride = layer.stride;
+        }
+        return x;
+    }
+
+    // One gradient descent step on the mean squared error of a batch; targets are
+    // Outputs() floats per sample, targetStride apart. Returns the batch's mean of
+    // 0.5 * |output - target|^2 before the step.
+    float TrainBatch(const float* input, int inputStride, const float* target, int targetStride,
+                     int batch, float learningRate) {
+        Own();
+        gradients.Reserve(parameterCount);
+        const float* output = Forward(input, inputStride, batch);
+        ReserveDeltas(batch);
+        std::vector<AlignedArray<float>>& activations = work.activations;
+
+        int last = LayerCount() - 1;
+        int stride = layers[last].stride;
+        float* delta = deltas[last].Data();
+        float loss = 0.0f;
+        for (int b = 0; b < batch; b++) {
+            for (int o = 0; o < stride; o++) {
+                float e = (o < Outputs()) ? output[b * stride + o] - target[b * targetStride + o] : 0.0f;
+                delta[b * stride + o] = e;
+                loss += e * e;
+            }
+        }
+
+        float step = -learningRate / batch;
+        for (int l = last; l >= 0; l--) {
+            const Layer& layer = layers[l];
+            float* d = deltas[l].Data();
+            kernels.ActivationGrad(activations[l].Data(), d, batch * layer.stride, layer.activation);
+
+            // Weight gradient X^T * delta, then the bias gradient as a sum over the batch
+            const float* x = (l > 0) ? activations[l - 1].Data() : input;
+            int xStride = (l > 0) ? layers[l - 1].stride : inputStride;
+            float* g = gradients.Data() + layer.weights;
+            memset(g, 0, sizeof(float) * (layer.inputs + 1) * layer.stride);
+            kernels.MatMulAdd(x, 1, xStride, d, layer.stride, g, layer.stride, layer.inputs, layer.stride, batch);
+            float* gBias = g + layer.inputs * layer.stride;
+            for (int b = 0; b < batch; b++) kernels.Axpy(gBias, d + b * layer.stride, 1.0f, layer.stride);
+
+            // Error at the previous layer, delta * W^T, through the weights before the step
+            if (l > 0) {
+                int inStride = layers[l - 1].stride;
+                Transpose(layer, inStride);
+                float* previous = deltas[l - 1].Data();
+                memset(previous, 0, sizeof(float) * batch * inStride);
+                kernels.MatMulAdd(d, layer.stride, 1, transposed.Data(), inStride, previous, inStride, batch, inStride, layer.outputs);
+            }
+
+            kernels.Axpy(parameters.Data() + layer.weights, g, step, (layer.inputs + 1) * layer.stride);
+        }
+        return 0.5f * loss / batch;
+    }
+
+    // Use a particular kernel set (for benchmarks); the default is the best one available
+    void SetSimdLevel(SimdLevel level) { kernels = DenseKernels::For(level); }
+    SimdLevel GetSimdLevel() const { return kernels.level; }
+
+private:
+    struct Layer {
+        int inputs, outputs;
+        int stride;          // Padded outputs
+        int weights;         // Offset of the weights in the parameter array; the biases follow
+        Activation activation;
+    };
+
+    void SetLayout(const std::vector<int>& layerSizes, const std::vector<Activation>& functions) {
+        sizes = layerSizes;
+        layers.clear();
+        int offset = 0;
+        for (size_t l = 0; l + 1 < sizes.size(); l++) {
+            Layer layer;
+            layer.inputs = sizes[l];
+            layer.outputs = sizes[l + 1];
+            layer.stride = PadDenseWidth(layer.outputs);
+            layer.weights = offset;
+            layer.activation = functions[l];
+            offset += (layer.inputs + 1) * layer.stride;
+            layers.push_back(layer);
+        }
+        parameterCount = offset;
+        deltas.clear();
+        deltas.resize(layers.size());
+        deltaCapacity = 0;
+        layoutVersion = NextLayoutVersion();
+        progress = 0;
+    }
+
+    // Copy mapped weights into our own memory before they are changed
+    void Own() {
+        if (!Mapped()) return;
+        parameters.Reserve(parameterCount);
+        memcpy(parameters.Data(), params, sizeof(float) * parameterCount);
+        params = parameters.Data();
+        mapping.Close();
+    }
+
+    static uint64_t CheckpointDataOffset(size_t layerCount) {
+        uint64_t end = sizeof(DenseCheckpointHeader) + layerCount * sizeof(DenseCheckpointLayer);
+        return (end + denseCheckpointAlignment - 1) / denseCheckpointAlignment * denseCheckpointAlignment;
+    }
+
+    static bool CheckpointError(std::string* error, const std::string& message) {
+        if (error) *error = message;
+        return false;
+    }
+
+    // Numbered across all networks: a network built where a freed one was must not pass for
+    // it in a workspace that was sized for the old one
+    static int NextLayoutVersion() {
+        static std::atomic<int> counter(0);
+        return ++counter;
+    }
+
+    // Size a workspace for this network and `batch` rows
+    void Prepare(DenseWorkspace& workspace, int batch) const {
+        if (workspace.network != this || workspace.layoutVersion != layoutVersion) {
+            workspace.activations.clear();
+            workspace.activations.resize(layers.size());
+            workspace.capacity = 0;
+            workspace.network = this;
+            workspace.layoutVersion = layoutVersion;
+        }
+        if (batch <= workspace.capacity) return;
+        for (size_t l = 0; l < layers.size(); l++) workspace.activations[l].Reserve(batch * layers[l].stride);
+        workspace.capacity = batch;
+    }
+
+    void ReserveDeltas(int batch) {
+        if (batch <= deltaCapacity) return;
+        for (size_t l = 0; l < layers.size(); l++) deltas[l].Reserve(batch * layers[l].stride);
+        deltaCapacity = batch;
+    }
+
+    // Layer weights as an outputs x inputs matrix with inStride-float rows, zero padded
+    void Transpose(const Layer& layer, int inStride) {
+        transposed.Reserve(layer.outputs * inStride);
+        const float* w = parameters.Data() + layer.weights;
+        for (int o = 0; o < layer.outputs; o++) {
+            float* row = transposed.Data() + o * inStride;
+            for (int i = 0; i < layer.inputs; i++) row[i] = w[i * layer.stride + o];
+            for (int i = layer.inputs; i < inStride; i++) row[i] = 0.0f;
+        }
+    }
+
+    std::vector<int> sizes;
+    std::vector<Layer> layers;
+    AlignedArray<float> parameters, gradients;
+    const float* params = nullptr;                        // parameters, or the mapped checkpoint
+    int parameterCount = 0;
+    MappedFile mapping;
+    uint64_t progress = 0;
+    DenseWorkspace work;                                  // For Forward() without a workspace
+    std::vector<AlignedArray<float>> deltas;              // Per layer error, batch rows
+    int deltaCapacity = 0;                                // Batch rows the deltas hold
+    int layoutVersion = 0;
+    AlignedArray<float> transposed;
+    DenseKernels kernels = DenseKernels::Get();
+};
+
+#endif // DENSENETWORK_H
@@ -0,0 +1,363 @@
+#ifndef FLUIDSOLVER_H
+#define FLUIDSOLVER_H
+
+#include "raylib.h"
+#include "NeighborGrid.h"
+#include "ParticleBuffer.h"
+#include "ParticleKernels.h"
+#include "JobSystem.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Solver settings, in pixels and seconds
+struct FluidParams {
+    float smoothingRadius = 16.0f;   // Kernel support h, also the neighbor grid cell size
+    float restSpacing = 8.0f;        // Particle spacing at rest density (2*particleRadius)
+    float particleRadius = 4.0f;     // Keeps particle centers this far from the walls
+    Vector2 gravity = { 0.0f, 1800.0f };
+    float damping = 1.0f;            // Velocity scale per substep (1 = no drag)
+    int substeps = 2;                // Solver substeps per Step(), each with its own neighbor lists
+    int iterations = 2;              // Density constraint iterations per substep (raise for deep tanks)
+    float relaxation = 0.2f;         // Constraint softening, relative to a full neighborhood
+    float viscosity = 0.05f;         // XSPH velocity smoothing (0 = none, 1 = fully averaged)
+    SimdLevel simd = SIMD_AVX2;      // Widest integration kernels to use, if the CPU has them
+};
+
+// 2D SPH kernels with their normalization constants precomputed for one smoothing radius
+struct SphKernels {
+    float h = 1.0f;
+    float h2 = 1.0f;
+    float poly6 = 0.0f;      // W(r) = poly6*(h^2 - r^2)^3
+    float spikyGrad = 0.0f;  // |grad W(r)| = spikyGrad*(h - r)^2
+
+    SphKernels() = default;
+    explicit SphKernels(float radius) {
+        h = radius;
+        h2 = radius * radius;
+        poly6 = 4.0f / (PI * std::pow(radius, 8.0f));
+        spikyGrad = 30.0f / (PI * std::pow(radius, 5.0f));
+    }
+
+    // Both are zero outside the support, without branching
+    float Density(float r2) const { float x = std::max(h2 - r2, 0.0f); return poly6 * x * x * x; }
+    float GradientScale(float r) const { float x = std::max(h - r, 0.0f); return spikyGrad * x * x; }
+};
+
+// Position-based fluid solver (Macklin & Mueller 2013): particles are advected, then
+// their positions are projected onto the incompressibility constraint rho_i = rho0 with
+// a few Jacobi iterations, using SPH density estimation (poly6) and pressure gradients
+// (spiky). XSPH smoothing provides viscosity. Stable at frame-sized time steps, so the
+// whole tub advances with a couple of substeps per frame.
+//
+// The particles are reordered by grid cell once per Step(), so neighbors are close in
+// memory. Every pass gathers from per-particle neighbor lists into registers and writes
+// only its own particle: there are no read-modify-write chains through memory, and any
+// range of particles can be processed independently. With a JobSystem every pass runs
+// in parallel over particle ranges; the results do not depend on the thread count.
+class FluidSolver {
+public:
+    FluidSolver(Rectangle bounds, const FluidParams& params = FluidParams(), JobSystem* jobs = nullptr) : jobs(jobs) {
+        Configure(bounds, params);
+    }
+
+    void Configure(Rectangle bounds, const FluidParams& params) {
+        this->bounds = bounds;
+        this->params = params;
+        kernels = SphKernels(params.smoothingRadius);
+        grid.Configure(bounds, params.smoothingRadius);
+        integrate = ParticleKernels::For(params.simd);
+
+        // Rest density and constraint softening measured on a particle inside a square
+        // lattice at restSpacing, so both stay consistent when h or the spacing change
+        restDensity = 0.0f;
+        float gradSq = 0.0f;
+        int reach = static_cast<int>(params.smoothingRadius / params.restSpacing) + 1;
+        for (int y = -reach; y <= reach; y++) {
+            for (int x = -reach; x <= reach; x++) {
+                float dx = x * params.restSpacing, dy = y * params.restSpacing;
+                float r2 = dx * dx + dy * dy;
+                if (r2 >= kernels.h2) continue;
+                restDensity += kernels.Density(r2);
+                if (r2 > 0.0f) {
+                    float g = kernels.GradientScale(std::sqrt(r2));
+                    gradSq += g * g;
+                }
+            }
+        }
+        invRestDensity = 1.0f / restDensity;
+        epsilon = params.relaxation * gradSq * invRestDensity * invRestDensity;
+        maxCorrection = 0.25f * params.restSpacing;
+    }
+
+    // Advance every particle by dt seconds. External velocity changes (mouse, etc.)
+    // should be applied to the particles before calling this. Reorders the particles,
+    // and leaves the reordered positions from before the step in previousX/previousY.
+    void Step(ParticleBuffer& particles, float dt) {
+        int count = particles.Count();
+        int padded = particles.PaddedCount();
+        predictedX.Reserve(padded); predictedY.Reserve(padded);
+        correctedX.Reserve(padded); correctedY.Reserve(padded);
+        density.resize(count);
+        lambda.resize(count);
+        neighborStart.resize(count + 1);
+
+        SortByCell(particles);
+        float h = dt / params.substeps;
+        for (int s = 0; s < params.substeps; s++) Substep(particles, h);
+        ApplyViscosity(particles);
+    }
+
+    float RestDensity() const { return restDensity; }
+    const std::vector<float>& Densities() const { return density; }
+    const NeighborGrid& Grid() const { return grid; }
+    SimdLevel Simd() const { return integrate.level; }
+    int Threads() const { return jobs ? jobs->ThreadCount() : 1; }
+
+private:
+    // Particles per parallel range: neighbor passes cost ~20 neighbors per particle, the
+    // integration kernels a few instructions; both are multiples of particleLanes
+    static const int neighborGrain = 512;
+    static const int integrateGrain = 8192;
+
+    template <typename Fn>
+    void ForRanges(int count, int grain, const Fn& fn) {
+        if (jobs) jobs->ParallelFor(0, count, grain, fn);
+        else fn(0, count);
+    }
+
+    void SortByCell(ParticleBuffer& particles) {
+        int count = particles.Count();
+        grid.Rebuild(count, [&](int i) { return particles.Position(i); });
+        sorted.Resize(count);
+        ForRanges(count, integrateGrain, [&](int begin, int end) {
+            for (int k = begin; k < end; k++) {
+                int i = grid.sortedIndex[k];
+                sorted.x[k] = particles.x[i]; sorted.y[k] = particles.y[i];
+                sorted.vx[k] = particles.vx[i]; sorted.vy[k] = particles.vy[i];
+                sorted.previousX[k] = particles.x[i]; sorted.previousY[k] = particles.y[i];
+                sorted.color[k] = particles.color[i];
+            }
+        });
+        particles.swap(sorted);
+    }
+
+    void Substep(ParticleBuffer& particles, float dt) {
+        int count = particles.Count();
+        int padded = particles.PaddedCount();
+        IntegrateParams ip = Walls();
+        ip.gravityX = params.gravity.x; ip.gravityY = params.gravity.y;
+        ip.damping = params.damping;
+        ip.dt = dt;
+
+        // Advect with gravity and keep the predictions inside the glass
+        ForRanges(padded, integrateGrain, [&](int begin, int end) {
+            integrate.Predict(particles.x.Data() + begin, particles.y.Data() + begin,
+                              particles.vx.Data() + begin, particles.vy.Data() + begin,
+                              predictedX.Data() + begin, predictedY.Data() + begin, end - begin, ip);
+        });
+
+        // Neighbors within h of the predicted positions; particles move much less than h
+        // during the constraint iterations, so the lists hold for the whole substep
+        BuildNeighborLists(count);
+        for (int it = 0; it < params.iterations; it++) {
+            ForRanges(count, neighborGrain, [&](int begin, int end) { ComputeLambda(begin, end); });
+            ForRanges(count, neighborGrain, [&](int begin, int end) { ApplyCorrections(begin, end); });
+            predictedX.swap(correctedX);
+            predictedY.swap(correctedY);
+            ForRanges(padded, integrateGrain, [&](int begin, int end) {
+                integrate.Clamp(predictedX.Data() + begin, predictedY.Data() + begin, end - begin, ip);
+            });
+        }
+
+        // Velocities from the corrected positions
+        ForRanges(padded, integrateGrain, [&](int begin, int end) {
+            integrate.UpdateVelocity(particles.x.Data() + begin, particles.y.Data() + begin,
+                                     predictedX.Data() + begin, predictedY.Data() + begin,
+                                     particles.vx.Data() + begin, particles.vy.Data() + begin, end - begin, 1.0f / dt);
+        });
+    }
+
+    IntegrateParams Walls() const {
+        IntegrateParams ip = {};
+        float r = params.particleRadius;
+        ip.minX = bounds.x + r; ip.maxX = bounds.x + bounds.width - r;
+        ip.minY = bounds.y + r; ip.maxY = bounds.y + bounds.height - r;
+        return ip;
+    }
+
+    // Each block of neighborGrain particles collects its lists into its own buffer, with
+    // block-relative starts; the blocks are then concatenated into the CSR arrays. Block
+    // boundaries do not depend on the thread count, so neither does the result.
+    void BuildNeighborLists(int count) {
+        const float* px = predictedX.Data();
+        const float* py = predictedY.Data();
+        grid.Rebuild(count, [&](int i) { return Vector2{ px[i], py[i] }; });
+
+        int blocks = (count + neighborGrain - 1) / neighborGrain;
+        if (static_cast<int>(blockNeighbors.size()) < blocks) blockNeighbors.resize(blocks);
+        blockStart.resize(blocks + 1);
+        ForRanges(blocks, 1, [&](int firstBlock, int lastBlock) {
+            for (int b = firstBlock; b < lastBlock; b++) {
+                blockStart[b + 1] = CollectNeighbors(b * neighborGrain, std::min(count, (b + 1) * neighborGrain), blockNeighbors[b]);
+            }
+        });
+
+        blockStart[0] = 0;
+        for (int b = 0; b < blocks; b++) blockStart[b + 1] += blockStart[b];
+        int total = blockStart[blocks];
+        if (total > static_cast<int>(neighbors.size())) neighbors.resize(total + total / 4);
+        gradScale.resize(total);
+
+        ForRanges(blocks, 1, [&](int firstBlock, int lastBlock) {
+            for (int b = firstBlock; b < lastBlock; b++) {
+                int base = blockStart[b];
+                std::copy(blockNeighbors[b].begin(), blockNeighbors[b].begin() + (blockStart[b + 1] - base), neighbors.begin() + base);
+                for (int i = b * neighborGrain; i < std::min(count, (b + 1) * neighborGrain); i++) neighborStart[i] += base;
+            }
+        });
+        neighborStart[count] = total;
+    }
+
+    // Lists for particles [begin, end) into `out`, returning their length. Candidates are
+    // written unconditionally and the count only advances for the ones within range, which
+    // avoids a mispredicted branch per candidate.
+    int CollectNeighbors(int begin, int end, std::vector<int>& out) {
+        const float* px = predictedX.Data();
+        const float* py = predictedY.Data();
+        int n = 0;
+        for (int i = begin; i < end; i++) {
+            neighborStart[i] = n;
+            Vector2 p = { px[i], py[i] };
+            grid.ForEachCandidateSpan(p, [&](int spanBegin, int spanEnd) {
+                if (n + (spanEnd - spanBegin) > static_cast<int>(out.size())) out.resize(2 * (n + spanEnd - spanBegin));
+                for (int k = spanBegin; k < spanEnd; k++) {
+                    int j = grid.sortedIndex[k];
+                    float dx = p.x - px[j], dy = p.y - py[j];
+                    out[n] = j;
+                    n += (dx * dx + dy * dy < kernels.h2) & (j != i);
+                }
+            });
+        }
+        return n;
+    }
+
+    // Offset from neighbor j to particle i. Particles stacked on the same spot (pinned into
+    // a corner) get a tiny deterministic split so the constraint can separate them.
+    Vector2 Offset(int i, int j) const {
+        Vector2 d = { predictedX[i] - predictedX[j], predictedY[i] - predictedY[j] };
+        if (d.x * d.x + d.y * d.y < 1e-8f) d.x = (i < j) ? -1e-2f : 1e-2f;
+        return d;
+    }
+
+    // Density estimate and constraint multiplier lambda_i = -C_i/(sum |grad C_i|^2 + eps).
+    // Also stores each neighbor's kernel gradient scale, which ApplyCorrections() reuses
+    // because the positions do not move in between.
+    void ComputeLambda(int begin, int end) {
+        float self = kernels.Density(0.0f);
+        for (int i = begin; i < end; i++) {
+            float rho = self;
+            Vector2 gradSum = { 0, 0 };
+            float gradSq = 0.0f;
+
+            for (int k = neighborStart[i]; k < neighborStart[i + 1]; k++) {
+                Vector2 d = Offset(i, neighbors[k]);
+                float r2 = d.x * d.x + d.y * d.y;
+                rho += kernels.Density(r2);
+
+                // grad W_ij = -GradientScale(r)*d/r
+                float r = std::sqrt(r2);
+                float g = kernels.GradientScale(r) / r * invRestDensity;
+                gradScale[k] = g;
+                gradSum.x += g * d.x; gradSum.y += g * d.y;
+                gradSq += g * g * r2;
+            }
+
+            density[i] = rho;
+            // Only push particles apart: an under-dense free surface must not pull in
+            float c = std::max(rho * invRestDensity - 1.0f, 0.0f);
+            lambda[i] = -c / (gradSq + gradSum.x * gradSum.x + gradSum.y * gradSum.y + epsilon);
+        }
+    }
+
+    // Position correction dp_i = 1/rho0 * sum_j (lambda_i + lambda_j) grad W_ij, limited
+    // to maxCorrection per iteration so a badly compressed cluster cannot explode.
+    // Corrections are computed from the old positions into correctedX/Y, which the caller
+    // swaps in once every range is done (Jacobi).
+    void ApplyCorrections(int begin, int end) {
+        float maxSq = maxCorrection * maxCorrection;
+        for (int i = begin; i < end; i++) {
+            float li = lambda[i];
+            Vector2 dp = { 0, 0 };
+
+            for (int k = neighborStart[i]; k < neighborStart[i + 1]; k++) {
+                int j = neighbors[k];
+                // The 1/rho0 factor is already folded into gradScale; lambda <= 0 pushes apart
+                float s = -(li + lambda[j]) * gradScale[k];
+                Vector2 d = Offset(i, j);
+                dp.x += s * d.x;
+                dp.y += s * d.y;
+            }
+
+            float lenSq = dp.x * dp.x + dp.y * dp.y;
+            if (lenSq > maxSq) {
+                float scale = maxCorrection / std::sqrt(lenSq);
+                dp.x *= scale; dp.y *= scale;
+            }
+            correctedX[i] = predictedX[i] + dp.x;
+            correctedY[i] = predictedY[i] + dp.y;
+        }
+    }
+
+    // XSPH: v_i += c * sum_j (v_j - v_i) W_ij / rho_j
+    void ApplyViscosity(ParticleBuffer& particles) {
+        if (params.viscosity <= 0.0f) return;
+        int count = particles.Count();
+        const float* x = particles.x.Data();
+        const float* y = particles.y.Data();
+        const float* vx = particles.vx.Data();
+        const float* vy = particles.vy.Data();
+
+        // Smoothed velocities go to the corrected arrays, then swap in
+        ForRanges(count, neighborGrain, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                Vector2 dv = { 0, 0 };
+                for (int k = neighborStart[i]; k < neighborStart[i + 1]; k++) {
+                    int j = neighbors[k];
+                    float dx = x[i] - x[j], dy = y[i] - y[j];
+                    float w = kernels.Density(dx * dx + dy * dy) / density[j];
+                    dv.x += (vx[j] - vx[i]) * w;
+                    dv.y += (vy[j] - vy[i]) * w;
+                }
+                correctedX[i] = vx[i] + params.viscosity * dv.x;
+                correctedY[i] = vy[i] + params.viscosity * dv.y;
+            }
+        });
+        particles.vx.swap(correctedX);
+        particles.vy.swap(correctedY);
+    }
+
+    Rectangle bounds = { 0, 0, 0, 0 };
+    FluidParams params;
+    SphKernels kernels;
+    NeighborGrid grid;
+    float restDensity = 1.0f;
+    float invRestDensity = 1.0f;
+    float epsilon = 0.0f;
+    float maxCorrection = 1.0f;
+    ParticleKernels integrate = ParticleKernels::For(SIMD_SCALAR);
+    JobSystem* jobs = nullptr;       // Not owned; null runs everything on the calling thread
+
+    std::vector<int> neighborStart;  // CSR neighbor lists: neighbors of i are
+    std::vector<int> neighbors;      // neighbors[neighborStart[i] .. neighborStart[i + 1])
+    std::vector<float> gradScale;    // Per neighbor entry, from the last ComputeLambda()
+    std::vector<std::vector<int>> blockNeighbors;  // Per-block lists before concatenation
+    std::vector<int> blockStart;
+    ParticleBuffer sorted;
+    AlignedArray<float> predictedX, predictedY;
+    AlignedArray<float> correctedX, correctedY;  // Scratch for Jacobi updates and XSPH
+    std::vector<float> density;
+    std::vector<float> lambda;
+};
+
+#endif // FLUIDSOLVER_H
@@ -0,0 +1,326 @@
+#ifndef HYPERPARAMETERSWEEP_H
+#define HYPERPARAMETERSWEEP_H
+
+#include "NeuralNetwork.h"
+#include "CrossValidation.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Hyperparameter search for main.cpp's Network. A spec file picks the candidate
+// configurations (a full grid, or random samples) and how hard to train them:
+//
+//     search = grid          # grid or random
+//     stopping = halving     # none, early or halving
+//     l_rate = 0.03 0.1 0.3 1
+//     n_hidden = 2 5 10 20
+//     n_epoch = 500
+//     batch_size = 1 4 16
+//
+// For random search a parameter can also be a range, lo..hi: l_rate is then drawn
+// log-uniformly, the others uniformly. Every configuration is trained on every fold,
+// and each (configuration, fold) pair is one job on the JobSystem.
+//
+// Each job holds back part of its training rows for validation; stopping decisions
+// and the ranking use that, never the test fold.
+// - none: every job trains for its full n_epoch.
+// - early: a job stops once its validation accuracy has not improved for `patience`
+//   epochs, and keeps its best weights.
+// - halving (successive halving): all configurations get min_epochs, then only the best
+//   1/eta of them (by mean validation accuracy) continue for eta times as long, and so
+//   on up to n_epoch. Most of the budget goes to the configurations worth training.
+
+struct SweepConfig {
+    float lRate;
+    int hidden;
+    int epochs;
+    int batchSize;
+};
+
+enum SweepSearch { SWEEP_GRID = 0, SWEEP_RANDOM };
+enum SweepStopping { SWEEP_STOP_NONE = 0, SWEEP_STOP_EARLY, SWEEP_STOP_HALVING };
+
+struct SweepSpec {
+    SweepSearch search = SWEEP_GRID;
+    SweepStopping stopping = SWEEP_STOP_NONE;
+    int samples = 20;               // Configurations drawn by random search
+    unsigned int seed = 1;          // Folds, random search and weight initialization
+    int folds = 5;
+    float validation = 0.2f;        // Fraction of each job's training rows held back
+    int checkEvery = 10;            // Epochs between validation checks
+    int patience = 50;              // Early stopping: epochs without improvement
+    int minEpochs = 20;             // Halving: budget of the first round
+    int eta = 3;                    // Halving: keep 1/eta, multiply the budget by eta
+    std::string output = "sweep_results.csv";
+
+    // Values or lo..hi ranges, as written in the spec
+    std::vector<std::string> lRate = { "0.3" }, hidden = { "5" }, epochs = { "500" }, batchSize = { "4" };
+};
+
+// Read a spec file (key = value lines, # comments). False with a message on errors.
+inline bool LoadSweepSpec(const char* path, SweepSpec& spec, std::string* error = nullptr) {
+    auto fail = [&](int line, const std::string& message) {
+        if (error) *error = (line > 0 ? "line " + std::to_string(line) + ": " : std::string()) + message;
+        return false;
+    };
+
+    std::ifstream file(path);
+    if (!file) return fail(0, std::string("cannot open ") + path);
+
+    std::string text;
+    for (int line = 1; std::getline(file, text); line++) {
+        text = text.substr(0, text.find('#'));
+        size_t equals = text.find('=');
+        std::istringstream keyStream(text.substr(0, equals));
+        std::string key;
+        if (!(keyStream >> key)) continue;
+        if (equals == std::string::npos) return fail(line, "expected key = value");
+
+        std::istringstream valueStream(text.substr(equals + 1));
+        std::vector<std::string> values;
+        for (std::string v; valueStream >> v;) values.push_back(v);
+        if (values.empty()) return fail(line, "no value for " + key);
+
+        const std::string& v = values[0];
+        if (key == "l_rate") spec.lRate = values;
+        else if (key == "n_hidden") spec.hidden = values;
+        else if (key == "n_epoch") spec.epochs = values;
+        else if (key == "batch_size") spec.batchSize = values;
+        else if (key == "search" && (v == "grid" || v == "random")) spec.search = (v == "grid") ? SWEEP_GRID : SWEEP_RANDOM;
+        else if (key == "stopping" && (v == "none" || v == "early" || v == "halving")) {
+            spec.stopping = (v == "none") ? SWEEP_STOP_NONE : (v == "early") ? SWEEP_STOP_EARLY : SWEEP_STOP_HALVING;
+        }
+        else if (key == "samples") spec.samples = std::max(1, atoi(v.c_str()));
+        else if (key == "seed") spec.seed = static_cast<unsigned int>(strtoul(v.c_str(), nullptr, 10));
+        else if (key == "folds") spec.folds = std::max(2, atoi(v.c_str()));
+        else if (key == "validation") spec.validation = std::min(std::max(static_cast<float>(atof(v.c_str())), 0.05f), 0.5f);
+        else if (key == "check_every") spec.checkEvery = std::max(1, atoi(v.c_str()));
+        else if (key == "patience") spec.patience = std::max(1, atoi(v.c_str()));
+        else if (key == "min_epochs") spec.minEpochs = std::max(1, atoi(v.c_str()));
+        else if (key == "eta") spec.eta = std::max(2, atoi(v.c_str()));
+        else if (key == "output") spec.output = v;
+        else return fail(line, "unknown setting " + key + " = " + v);
+    }
+    return true;
+}
+
+// One value from a spec list: a random entry, or a draw from a lo..hi range
+inline float SampleSweepValue(const std::vector<std::string>& values, bool logScale, bool integer, std::mt19937& rng) {
+    const std::string& v = values[rng() % values.size()];
+    size_t dots = v.find("..");
+    if (dots == std::string::npos) return static_cast<float>(atof(v.c_str()));
+    float lo = static_cast<float>(atof(v.substr(0, dots).c_str())), hi = static_cast<float>(atof(v.substr(dots + 2).c_str()));
+    if (integer) return static_cast<float>(std::uniform_int_distribution<int>(static_cast<int>(lo), static_cast<int>(hi))(rng));
+    if (logScale && lo > 0.0f) return std::exp(std::uniform_real_distribution<float>(std::log(lo), std::log(hi))(rng));
+    return std::uniform_real_distribution<float>(lo, hi)(rng);
+}
+
+// Candidate configurations: the full grid (ranges use their lower end) or random samples
+inline std::vector<SweepConfig> ExpandSweep(const SweepSpec& spec) {
+    std::vector<SweepConfig> configs;
+    if (spec.search == SWEEP_GRID) {
+        auto value = [](const std::string& v) { return static_cast<float>(atof(v.c_str())); };
+        for (const std::string& l : spec.lRate)
+            for (const std::string& h : spec.hidden)
+                for (const std::string& e : spec.epochs)
+                    for (const std::string& b : spec.batchSize)
+                        configs.push_back({ value(l), static_cast<int>(value(h)), static_cast<int>(value(e)), static_cast<int>(value(b)) });
+    } else {
+        std::mt19937 rng(spec.seed);
+        for (int k = 0; k < spec.samples; k++) {
+            SweepConfig c;
+            c.lRate = SampleSweepValue(spec.lRate, true, false, rng);
+            c.hidden = static_cast<int>(SampleSweepValue(spec.hidden, false, true, rng));
+            c.epochs = static_cast<int>(SampleSweepValue(spec.epochs, false, true, rng));
+            c.batchSize = static_cast<int>(SampleSweepValue(spec.batchSize, false, true, rng));
+            configs.push_back(c);
+        }
+    }
+    for (SweepConfig& c : configs) {
+        c.hidden = std::max(c.hidden, 1);
+        c.epochs = std::max(c.epochs, 1);
+        c.batchSize = std::max(c.batchSize, 1);
+    }
+    return configs;
+}
+
+// Percentage of rows the network classifies correctly
+inline float SweepAccuracy(Network& network, const DataView& rows) {
+    std::vector<int> predicted(rows.count);
+    network.predict_batch(rows, predicted.data());
+    int correct = 0;
+    for (int k = 0; k < rows.count; k++) correct += (predicted[k] == static_cast<int>(rows.Label(k)));
+    return rows.count ? 100.0f * correct / rows.count : 0.0f;
+}
+
+struct SweepResult {
+    SweepConfig config;
+    float validation = 0.0f;   // Mean best validation accuracy over the folds
+    float test = 0.0f;         // Mean test accuracy over the folds, with the best weights
+    float testSpread = 0.0f;   // Standard deviation of the test accuracy
+    float epochsTrained = 0.0f; // Mean over the folds
+    int round = 0;             // Halving: last round reached
+    bool stoppedEarly = false; // Some fold hit the patience limit
+};
+
+class HyperparameterSweep {
+public:
+    HyperparameterSweep(const DataMatrix& data, const SweepSpec& spec)
+        : spec(spec), folds(data, spec.folds, spec.seed) {}
+
+    // Train every candidate and return the results, best validation accuracy first
+    std::vector<SweepResult> Run(JobSystem& jobs) {
+        std::vector<SweepConfig> configs = ExpandSweep(spec);
+        int configCount = static_cast<int>(configs.size()), foldCount = folds.Count();
+        trials.clear();
+        trials.resize(configCount * foldCount);
+        for (int c = 0; c < configCount; c++) {
+            for (int f = 0; f < foldCount; f++) Setup(trials[c * foldCount + f], configs[c], f, c);
+        }
+
+        // Rounds: one with the full budget, or growing budgets for successive halving
+        std::vector<int> alive(configCount);
+        for (int c = 0; c < configCount; c++) alive[c] = c;
+        int maxEpochs = 0;
+        for (const SweepConfig& c : configs) maxEpochs = std::max(maxEpochs, c.epochs);
+        int budget = (spec.stopping == SWEEP_STOP_HALVING) ? std::min(spec.minEpochs, maxEpochs) : maxEpochs;
+
+        std::vector<SweepResult> results(configCount);
+        for (int round = 0;; round++) {
+            jobs.ParallelFor(0, static_cast<int>(alive.size()) * foldCount, 1, [&](int begin, int end) {
+                for (int j = begin; j < end; j++) Train(trials[alive[j / foldCount] * foldCount + j % foldCount], budget);
+            });
+            for (int c : alive) results[c].round = round;
+            if (budget >= maxEpochs || alive.size() <= 1 || spec.stopping != SWEEP_STOP_HALVING) break;
+
+            // Keep the best 1/eta by mean validation accuracy, then raise the budget
+            std::vector<std::pair<float, int>> ranked;
+            for (int c : alive) ranked.push_back({ -MeanValidation(c), c });
+            std::stable_sort(ranked.begin(), ranked.end());
+            alive.clear();
+            int keep = std::max(1, static_cast<int>(ranked.size()) / spec.eta);
+            for (int k = 0; k < keep; k++) alive.push_back(ranked[k].second);
+            budget = std::min(budget * spec.eta, maxEpochs);
+        }
+
+        // Test every configuration with the best weights it reached
+        jobs.ParallelFor(0, configCount * foldCount, 1, [&](int begin, int end) {
+            for (int j = begin; j < end; j++) Test(trials[j]);
+        });
+        for (int c = 0; c < configCount; c++) {
+            SweepResult& r = results[c];
+            r.config = configs[c];
+            r.validation = MeanValidation(c);
+            float sum = 0.0f, sumSquares = 0.0f;
+            for (int f = 0; f < foldCount; f++) {
+                const Trial& trial = trials[c * foldCount + f];
+                sum += trial.test;
+                sumSquares += trial.test * trial.test;
+                r.epochsTrained += static_cast<float>(trial.epochs) / foldCount;
+                r.stoppedEarly |= trial.stopped;
+            }
+            r.test = sum / foldCount;
+            r.testSpread = std::sqrt(std::max(sumSquares / foldCount - r.test * r.test, 0.0f));
+        }
+        std::stable_sort(results.begin(), results.end(), [](const SweepResult& a, const SweepResult& b) { return a.validation > b.validation; });
+
+        totalEpochs = 0;
+        fullEpochs = 0;
+        for (const Trial& trial : trials) {
+            totalEpochs += trial.epochs;
+            fullEpochs += trial.config.epochs;
+        }
+        return results;
+    }
+
+    // Epochs trained over all jobs, and what training every job to its n_epoch would cost
+    long long TotalEpochs() const { return totalEpochs; }
+    long long FullEpochs() const { return fullEpochs; }
+
+private:
+    // One (configuration, fold) job
+    struct Trial {
+        SweepConfig config;
+        int fold = 0;
+        std::vector<int> rows;      // Training rows of the fold; the last ones validate
+        int fitCount = 0;
+        Network network;
+        std::vector<float> best;    // Parameters at the best validation accuracy
+        float bestValidation = -1.0f;
+        int bestEpoch = 0;
+        int epochs = 0;
+        bool stopped = false;
+        float test = 0.0f;
+    };
+
+    void Setup(Trial& trial, const SweepConfig& config, int fold, int configIndex) {
+        trial.config = config;
+        trial.fold = fold;
+        trial.rows = folds.TrainRows(fold);
+        int count = static_cast<int>(trial.rows.size());
+        trial.fitCount = count - std::max(1, static_cast<int>(count * spec.validation));
+        trial.network.batch_size = config.batchSize;
+        std::seed_seq seed{ spec.seed, static_cast<unsigned int>(configIndex), static_cast<unsigned int>(fold) };
+        std::mt19937 rng(seed);
+        trial.network.initialize_network(folds.Inputs(), config.hidden, folds.Classes(), rng());
+    }
+
+    // Continue training up to `budget` epochs (or the trial's own n_epoch), checking the
+    // validation accuracy every checkEvery epochs
+    void Train(Trial& trial, int budget) {
+        DataView fit = folds.View(trial.rows, 0, trial.fitCount);
+        DataView validation = folds.View(trial.rows, trial.fitCount, static_cast<int>(trial.rows.size()));
+        int target = std::min(budget, trial.config.epochs);
+        while (!trial.stopped && trial.epochs < target) {
+            int chunk = std::min(spec.checkEvery, target - trial.epochs);
+            trial.network.train(fit, trial.config.lRate, chunk, folds.Classes());
+            trial.epochs += chunk;
+
+            float accuracy = SweepAccuracy(trial.network, validation);
+            if (accuracy > trial.bestValidation) {
+                trial.bestValidation = accuracy;
+                trial.bestEpoch = trial.epochs;
+                const DenseNetwork& net = trial.network.net;
+                trial.best.assign(net.Parameters(), net.Parameters() + net.ParameterCount());
+            }
+            if (spec.stopping == SWEEP_STOP_EARLY && trial.epochs - trial.bestEpoch >= spec.patience) trial.stopped = true;
+        }
+    }
+
+    void Test(Trial& trial) {
+        if (!trial.best.empty()) std::copy(trial.best.begin(), trial.best.end(), trial.network.net.Parameters());
+        trial.test = SweepAccuracy(trial.network, folds.Test(trial.fold));
+    }
+
+    float MeanValidation(int config) const {
+        float sum = 0.0f;
+        for (int f = 0; f < folds.Count(); f++) sum += trials[config * folds.Count() + f].bestValidation;
+        return sum / folds.Count();
+    }
+
+    SweepSpec spec;
+    KFold folds;
+    std::vector<Trial> trials;
+    long long totalEpochs = 0, fullEpochs = 0;
+};
+
+// Results as CSV, best first. False if the file cannot be written.
+inline bool WriteSweepResults(const char* path, const std::vector<SweepResult>& results) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    fprintf(file, "l_rate,n_hidden,n_epoch,batch_size,epochs_trained,validation_accuracy,test_accuracy,test_stddev,round,stopped_early\n");
+    for (const SweepResult& r : results) {
+        fprintf(file, "%g,%d,%d,%d,%.1f,%.3f,%.3f,%.3f,%d,%d\n", r.config.lRate, r.config.hidden, r.config.epochs,
+                r.config.batchSize, r.epochsTrained, r.validation, r.test, r.testSpread, r.round, r.stoppedEarly ? 1 : 0);
+    }
+    fclose(file);
+    return true;
+}
+
+#endif // HYPERPARAMETERSWEEP_H
@@ -0,0 +1,191 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool for data-parallel loops over index ranges.
+//
+// ParallelFor() hands [begin, end) to the calling thread, which keeps halving its range:
+// it pushes the upper half onto its own queue and continues with the lower half until
+// the range is one grain long. Owners pop their newest (smallest) ranges, idle threads
+// steal the oldest (largest) ones from other queues, so uneven work balances itself
+// without a central queue. The caller helps run ranges and returns once all are done.
+//
+// Split points are always begin + a multiple of `grain`, so with an aligned begin and a
+// grain of a multiple of 8 every range starts on a whole AVX register.
+class JobSystem {
+public:
+    // threads counts the caller too; 0 uses every hardware thread
+    explicit JobSystem(int threads = 0) {
+        if (threads <= 0) threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        threadCount = threads;
+        queues.reset(new Queue[threads]);
+        for (int i = 1; i < threads; i++) workers.emplace_back([this, i] { WorkerLoop(i); });
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int ThreadCount() const { return threadCount; }
+
+    // Index of the calling thread in this pool, 0..ThreadCount()-1; threads outside the
+    // pool (workers of other pools included) get 0. Lets a ParallelFor body pick
+    // per-thread scratch space.
+    int CurrentThread() const { return Slot(); }
+
+    // Call fn(rangeBegin, rangeEnd) over disjoint ranges covering [begin, end), in parallel.
+    // Blocks until every range has run. Safe to nest: a waiting thread keeps running ranges.
+    template <typename Fn>
+    void ParallelFor(int begin, int end, int grain, const Fn& fn) {
+        if (end <= begin) return;
+        grain = std::max(grain, 1);
+        if (threadCount == 1 || end - begin <= grain) {
+            fn(begin, end);
+            return;
+        }
+
+        std::atomic<int> pending(1);
+        int slot = Slot();
+        Run({ &Invoke<Fn>, &fn, begin, end, grain, &pending }, slot);
+        while (pending.load(std::memory_order_acquire) > 0) {
+            Task task;
+            if (Pop(slot, task) || Steal(slot, task)) Run(task, slot);
+            else std::this_thread::yield();
+        }
+    }
+
+private:
+    struct Task {
+        void (*invoke)(const void* fn, int begin, int end);
+        const void* fn;
+        int begin, end, grain;
+        std::atomic<int>* pending;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    template <typename Fn>
+    static void Invoke(const void* fn, int begin, int end) { (*static_cast<const Fn*>(fn))(begin, end); }
+
+    // The pool a worker thread belongs to and its index there
+    struct Worker {
+        const JobSystem* pool = nullptr;
+        int slot = 0;
+    };
+
+    static Worker& CurrentWorker() {
+        static thread_local Worker worker;
+        return worker;
+    }
+
+    // Queue owned by the current thread; threads outside the pool share the first one
+    int Slot() const {
+        const Worker& worker = CurrentWorker();
+        return worker.pool == this ? worker.slot : 0;
+    }
+
+    void Run(Task task, int slot) {
+        for (;;) {
+            int grains = (task.end - task.begin + task.grain - 1) / task.grain;
+            if (grains <= 1) break;
+            Task upper = task;
+            upper.begin = task.begin + grains / 2 * task.grain;
+            task.end = upper.begin;
+            task.pending->fetch_add(1, std::memory_order_relaxed);
+            Push(slot, upper);
+        }
+        task.invoke(task.fn, task.begin, task.end);
+        task.pending->fetch_sub(1, std::memory_order_release);
+    }
+
+    void Push(int slot, const Task& task) {
+        {
+            std::lock_guard<std::mutex> lock(queues[slot].mutex);
+            queues[slot].tasks.push_back(task);
+        }
+        queued.fetch_add(1);
+        if (sleeping.load() > 0) {
+            // Sequentially consistent counters plus the lock: either the worker sees `queued`
+            // before it waits, or it is already waiting when notified
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            wake.notify_one();
+        }
+    }
+
+    bool Pop(int slot, Task& task) {
+        std::lock_guard<std::mutex> lock(queues[slot].mutex);
+        if (queues[slot].tasks.empty()) return false;
+        task = queues[slot].tasks.back();
+        queues[slot].tasks.pop_back();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Steal(int thief, Task& task) {
+        for (int k = 1; k < threadCount; k++) {
+            Queue& victim = queues[(thief + k) % threadCount];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) continue;
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(int slot) {
+        CurrentWorker() = { this, slot };
+        int idle = 0;
+        for (;;) {
+            Task task;
+            if (Pop(slot, task) || Steal(slot, task)) {
+                Run(task, slot);
+                idle = 0;
+                continue;
+            }
+
+            // Loops are issued back to back during a step, so spin briefly before sleeping
+            if (++idle < 256) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleeping.fetch_add(1);
+            wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+            sleeping.fetch_sub(1);
+            if (stopping) return;
+            idle = 0;
+        }
+    }
+
+    int threadCount = 1;
+    std::unique_ptr<Queue[]> queues;
+    std::vector<std::thread> workers;
+    std::atomic<int> queued{ 0 };    // Tasks sitting in any queue
+    std::atomic<int> sleeping{ 0 };  // Workers blocked on `wake`
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+#endif // JOBSYSTEM_H
@@ -0,0 +1,103 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <utility>
+
+#if defined(_WIN32)
+    // Keep windows.h from declaring names raylib.h also uses (Rectangle, CloseWindow, ...)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #define NOGDI
+    #define NOUSER
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Read-only view of a whole file through the virtual memory system: no read() calls and
+// no copy into a buffer, pages are faulted in as they are touched. The file is hinted as
+// read front to back.
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const char* path) { Open(path); }
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept { swap(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept { swap(other); return *this; }
+
+    // False if the file cannot be opened or mapped. An empty file maps to no data.
+    bool Open(const char* path) {
+        Close();
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) { CloseHandle(file); return false; }
+        bytes = static_cast<size_t>(size.QuadPart);
+        if (bytes > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping); // The view keeps the mapping alive
+            }
+        }
+        CloseHandle(file);
+#else
+        int file = open(path, O_RDONLY);
+        if (file < 0) return false;
+        struct stat info;
+        if (fstat(file, &info) != 0) { close(file); return false; }
+        bytes = static_cast<size_t>(info.st_size);
+        if (bytes > 0) {
+            void* view = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, file, 0);
+            if (view != MAP_FAILED) {
+                madvise(view, bytes, MADV_SEQUENTIAL);
+                data = static_cast<const char*>(view);
+            }
+        }
+        close(file);
+#endif
+        if (bytes > 0 && !data) bytes = 0;
+        else mapped = true;
+        return mapped;
+    }
+
+    void Close() {
+        if (data) {
+#if defined(_WIN32)
+            UnmapViewOfFile(data);
+#else
+            munmap(const_cast<char*>(data), bytes);
+#endif
+        }
+        data = nullptr;
+        bytes = 0;
+        mapped = false;
+    }
+
+    bool IsOpen() const { return mapped; }
+    const char* Data() const { return data; }
+    size_t Size() const { return bytes; }
+
+    void swap(MappedFile& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(bytes, other.bytes);
+        std::swap(mapped, other.mapped);
+    }
+
+private:
+    const char* data = nullptr;
+    size_t bytes = 0;
+    bool mapped = false;
+};
+
+#endif // MAPPEDFILE_H
@@ -1,19 +1,11 @@
 #include "raylib.h"
+#include "DenseNetwork.h"
 #include <cmath>
 #include <vector>
 #include <iostream>
 using namespace std;
-// Activation Function (Sigmoid)
-float sigmoid(float x) {
-    return 1.0f / (1.0f + exp(-x));
-}
-
-// Derivative of the Sigmoid (for backpropagation)
-float sigmoid_derivative(float x) {
-    return x * (1 - x);
-}
 
-// XOR Dataset
+// XOR Dataset, one sample per row
 float XOR_inputs[4][2] = {
     {0, 0},
     {0, 1},
@@ -23,94 +15,48 @@ float XOR_inputs[4][2] = {
 
 float XOR_outputs[4] = {0, 1, 1, 0};
 
-// Neural Network class
-class NeuralNetwork {
-public:
-    vector<float> hiddenLayer;
-    vector<float> outputLayer;
-    vector<float> weights_input_hidden;
-    vector<float> weights_hidden_output;
-    float learningRate = 0.1f;
-
-    NeuralNetwork() {
-        hiddenLayer.resize(4);
-        outputLayer.resize(1);
-
-        // Initialize weights randomly
-        weights_input_hidden = {RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat()};
-        weights_hidden_output = {RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat()};
-    }
+const float learningRate = 2.0f;
+const char* checkpointFile = "xor.nn"; // Trained weights, reused by the next run
 
-    float RandomFloat() {
-        return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+// 2-4-1 sigmoid network, trained on all four samples as one batch per step
+void train(DenseNetwork& nn, int epochs) {
+    for (int epoch = 0; epoch < epochs; epoch++) {
+        nn.TrainBatch(&XOR_inputs[0][0], 2, XOR_outputs, 1, 4, learningRate);
     }
+}
 
-    // Feedforward
-    void feedForward(float input1, float input2) {
-        // Input to Hidden
-        hiddenLayer[0] = sigmoid(input1 * weights_input_hidden[0] + input2 * weights_input_hidden[1]);
-        hiddenLayer[1] = sigmoid(input1 * weights_input_hidden[2] + input2 * weights_input_hidden[3]);
-        hiddenLayer[2] = sigmoid(input1 * weights_input_hidden[4] + input2 * weights_input_hidden[5]);
-        hiddenLayer[3] = sigmoid(input1 * weights_input_hidden[6] + input2 * weights_input_hidden[7]);
-
-        // Hidden to Output
-        outputLayer[0] = sigmoid(hiddenLayer[0] * weights_hidden_output[0] +
-                                 hiddenLayer[1] * weights_hidden_output[1] +
-                                 hiddenLayer[2] * weights_hidden_output[2] +
-                                 hiddenLayer[3] * weights_hidden_output[3]);
-    }
+// Visualization function: one column per layer, connections tinted by weight
+// (blue positive, red negative, stronger when larger)
+Vector2 neuronPosition(const DenseNetwork& nn, int layer, int neuron) {
+    float spacing = 100.0f;
+    return { 200.0f + 200.0f * layer, 350.0f + spacing * (neuron - (nn.Size(layer) - 1) / 2.0f) };
+}
 
-    // Backpropagation (simple XOR training)
-    void backpropagate(float input1, float input2, float expected_output) {
-        // Calculate output error
-        float outputError = expected_output - outputLayer[0];
-        
-        // Calculate gradients for output layer weights
-        for (int i = 0; i < 4; i++) {
-            weights_hidden_output[i] += learningRate * outputError * sigmoid_derivative(outputLayer[0]) * hiddenLayer[i];
-        }
+// Reads the network through its const accessors only, so a loaded checkpoint stays mapped
+void drawNeuralNetwork(const DenseNetwork& nn) {
+    Color layerColors[3] = { BLUE, GREEN, RED };
 
-        // Backpropagate to hidden layer
-        for (int i = 0; i < 4; i++) {
-            float hiddenError = outputError * sigmoid_derivative(outputLayer[0]) * weights_hidden_output[i];
-            weights_input_hidden[i * 2] += learningRate * hiddenError * input1;
-            weights_input_hidden[i * 2 + 1] += learningRate * hiddenError * input2;
-        }
-    }
-
-    void train(int epochs) {
-        for (int epoch = 0; epoch < epochs; epoch++) {
-            for (int i = 0; i < 4; i++) {
-                feedForward(XOR_inputs[i][0], XOR_inputs[i][1]);
-                backpropagate(XOR_inputs[i][0], XOR_inputs[i][1], XOR_outputs[i]);
+    for (int l = 0; l < nn.LayerCount(); l++) {
+        for (int i = 0; i < nn.Size(l); i++) {
+            for (int o = 0; o < nn.Size(l + 1); o++) {
+                float w = nn.Weight(l, i, o);
+                Color c = Fade(w > 0 ? BLUE : RED, fminf(fabsf(w) / 4.0f, 1.0f) * 0.8f + 0.2f);
+                DrawLineV(neuronPosition(nn, l, i), neuronPosition(nn, l + 1, o), c);
             }
         }
     }
-};
-
-// Visualization function
-void drawNeuralNetwork(NeuralNetwork& nn) {
-    int inputX = 200, hiddenX = 400, outputX = 600;
-    int inputY[2] = {300, 400}, hiddenY[4] = {200, 300, 400, 500}, outputY = 350;
-
-    // Draw input layer
-    for (int i = 0; i < 2; i++) {
-        DrawCircle(inputX, inputY[i], 20, BLUE);
-    }
 
-    // Draw hidden layer
-    for (int i = 0; i < 4; i++) {
-        DrawCircle(hiddenX, hiddenY[i], 20, GREEN);
-        // Draw connections from input to hidden
-        DrawLine(inputX, inputY[0], hiddenX, hiddenY[i], LIGHTGRAY);
-        DrawLine(inputX, inputY[1], hiddenX, hiddenY[i], LIGHTGRAY);
+    for (int l = 0; l <= nn.LayerCount(); l++) {
+        Color c = (l == 0) ? layerColors[0] : (l == nn.LayerCount()) ? layerColors[2] : layerColors[1];
+        for (int i = 0; i < nn.Size(l); i++) DrawCircleV(neuronPosition(nn, l, i), 20, c);
     }
 
-    // Draw output layer
-    DrawCircle(outputX, outputY, 20, RED);
-    // Draw connections from hidden to output
+    // What the trained network answers for each XOR input
+    static DenseWorkspace workspace;
+    const float* output = nn.Forward(&XOR_inputs[0][0], 2, 4, workspace);
     for (int i = 0; i < 4; i++) {
-        DrawLine(hiddenX, hiddenY[i], outputX, outputY, LIGHTGRAY);
+        DrawText(TextFormat("%.0f XOR %.0f = %.3f", XOR_inputs[i][0], XOR_inputs[i][1], output[i * nn.OutputStride()]),
+                 20, 20 + 25 * i, 20, DARKGRAY);
     }
 }
 
@@ -118,8 +64,13 @@ int main() {
     // Initialize Raylib
     InitWindow(800, 600, "Neural Network Visualization");
 
-    NeuralNetwork nn;
-    nn.train(10000);  // Train XOR neural network
+    // Train XOR neural network, unless an earlier run saved one
+    DenseNetwork nn;
+    if (!nn.Load(checkpointFile) || nn.Inputs() != 2 || nn.Outputs() != 1) {
+        nn.Initialize({ 2, 4, 1 }, ACTIVATION_SIGMOID, ACTIVATION_SIGMOID, 1);
+        train(nn, 10000);
+        nn.Save(checkpointFile, 10000);
+    }
 
     SetTargetFPS(60);
 
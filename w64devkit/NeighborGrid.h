@@ -0,0 +1,157 @@
+#ifndef NEIGHBORGRID_H
+#define NEIGHBORGRID_H
+
+#include "raylib.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Uniform-grid neighbor finder for particle simulations.
+//
+// Rebuild() buckets every particle into a cell of size `cellSize` with a counting sort:
+// after it runs, the particles of cell c are sortedIndex[cellStart[c] .. cellStart[c + 1]).
+// With cellSize >= the interaction radius every neighbor lies in the 3x3 block of cells
+// around a particle, so pair queries cost O(N) instead of O(N^2).
+//
+// Positions are read through an accessor `Vector2 pos(int i)` so the grid works with any
+// particle layout. Particles outside the bounds are clamped into the border cells.
+class NeighborGrid {
+public:
+    NeighborGrid() = default;
+    NeighborGrid(Rectangle bounds, float cellSize) { Configure(bounds, cellSize); }
+
+    // Set the simulated area and the cell size (use the interaction radius)
+    void Configure(Rectangle bounds, float cellSize) {
+        origin = { bounds.x, bounds.y };
+        this->cellSize = cellSize;
+        invCellSize = 1.0f / cellSize;
+        cols = std::max(1, static_cast<int>(std::ceil(bounds.width * invCellSize)));
+        rows = std::max(1, static_cast<int>(std::ceil(bounds.height * invCellSize)));
+        cellStart.assign(cols * rows + 1, 0);
+    }
+
+    int CellX(float x) const { return std::min(cols - 1, std::max(0, static_cast<int>((x - origin.x) * invCellSize))); }
+    int CellY(float y) const { return std::min(rows - 1, std::max(0, static_cast<int>((y - origin.y) * invCellSize))); }
+    int CellOf(Vector2 p) const { return CellY(p.y) * cols + CellX(p.x); }
+
+    // Bucket `count` particles into cells. Call once per step, after positions change.
+    template <typename PositionFn>
+    void Rebuild(int count, PositionFn pos) {
+        particleCell.resize(count);
+        sortedIndex.resize(count);
+        std::fill(cellStart.begin(), cellStart.end(), 0);
+
+        // Count particles per cell
+        for (int i = 0; i < count; i++) {
+            int c = CellOf(pos(i));
+            particleCell[i] = c;
+            cellStart[c + 1]++;
+        }
+
+        // Prefix sum turns the counts into the cell-start table
+        for (int c = 0; c < cols * rows; c++) cellStart[c + 1] += cellStart[c];
+
+        // Scatter particle indices into their cell ranges (stable, so cells stay ordered by index)
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (int i = 0; i < count; i++) sortedIndex[cursor[particleCell[i]]++] = i;
+    }
+
+    // Visit every particle j != self within `radius` of `p`: fn(j, delta, distSq), delta = pos(j) - p.
+    // The three cells of each row of the 3x3 block are adjacent in sortedIndex, so each row
+    // is scanned as one contiguous span.
+    template <typename PositionFn, typename Fn>
+    void ForEachNeighbor(Vector2 p, int self, float radius, PositionFn pos, Fn fn) const {
+        float radiusSq = radius * radius;
+        int cx = CellX(p.x), cy = CellY(p.y);
+        int x0 = std::max(0, cx - 1), x1 = std::min(cols - 1, cx + 1);
+        for (int y = std::max(0, cy - 1); y <= std::min(rows - 1, cy + 1); y++) {
+            int end = cellStart[y * cols + x1 + 1];
+            for (int k = cellStart[y * cols + x0]; k < end; k++) {
+                int j = sortedIndex[k];
+                if (j == self) continue;
+                Vector2 q = pos(j);
+                Vector2 d = { q.x - p.x, q.y - p.y };
+                float distSq = d.x * d.x + d.y * d.y;
+                if (distSq < radiusSq) fn(j, d, distSq);
+            }
+        }
+    }
+
+    // Call fn(begin, end) for the (up to) three spans of sortedIndex that hold the 3x3 block of
+    // cells around `p`. Lets callers run their own branch-free distance filtering.
+    template <typename Fn>
+    void ForEachCandidateSpan(Vector2 p, Fn fn) const {
+        int cx = CellX(p.x), cy = CellY(p.y);
+        int x0 = std::max(0, cx - 1), x1 = std::min(cols - 1, cx + 1);
+        for (int y = std::max(0, cy - 1); y <= std::min(rows - 1, cy + 1); y++) {
+            fn(cellStart[y * cols + x0], cellStart[y * cols + x1 + 1]);
+        }
+    }
+
+    // Visit every unordered pair closer than `radius` exactly once: fn(i, j, delta, distSq),
+    // delta = pos(j) - pos(i). Each cell is paired with itself and its four "forward"
+    // neighbors (E, SW, S, SE) so no pair is seen twice.
+    template <typename PositionFn, typename Fn>
+    void ForEachPair(float radius, PositionFn pos, Fn fn) const {
+        static const int offsets[4][2] = { { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+        float radiusSq = radius * radius;
+
+        for (int cy = 0; cy < rows; cy++) {
+            for (int cx = 0; cx < cols; cx++) {
+                int c = cy * cols + cx;
+                int begin = cellStart[c], end = cellStart[c + 1];
+                if (begin == end) continue;
+
+                // Pairs inside the cell
+                for (int a = begin; a < end; a++) {
+                    int i = sortedIndex[a];
+                    Vector2 p = pos(i);
+                    for (int b = a + 1; b < end; b++) {
+                        int j = sortedIndex[b];
+                        Vector2 q = pos(j);
+                        Vector2 d = { q.x - p.x, q.y - p.y };
+                        float distSq = d.x * d.x + d.y * d.y;
+                        if (distSq < radiusSq) fn(i, j, d, distSq);
+                    }
+                }
+
+                // Pairs with the forward neighbor cells
+                for (const auto &o : offsets) {
+                    int nx = cx + o[0], ny = cy + o[1];
+                    if (nx < 0 || nx >= cols || ny >= rows) continue;
+                    int n = ny * cols + nx;
+                    int nbegin = cellStart[n], nend = cellStart[n + 1];
+                    for (int a = begin; a < end; a++) {
+                        int i = sortedIndex[a];
+                        Vector2 p = pos(i);
+                        for (int b = nbegin; b < nend; b++) {
+                            int j = sortedIndex[b];
+                            Vector2 q = pos(j);
+                            Vector2 d = { q.x - p.x, q.y - p.y };
+                            float distSq = d.x * d.x + d.y * d.y;
+                            if (distSq < radiusSq) fn(i, j, d, distSq);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    int Cols() const { return cols; }
+    int Rows() const { return rows; }
+    float CellSize() const { return cellSize; }
+
+    std::vector<int> cellStart;    // cols*rows + 1 entries, cell c spans [cellStart[c], cellStart[c + 1])
+    std::vector<int> sortedIndex;  // Particle indices ordered by cell
+    std::vector<int> particleCell; // Cell of each particle from the last Rebuild()
+
+private:
+    Vector2 origin = { 0, 0 };
+    float cellSize = 1.0f;
+    float invCellSize = 1.0f;
+    int cols = 1;
+    int rows = 1;
+    std::vector<int> cursor;
+};
+
+#endif // NEIGHBORGRID_H
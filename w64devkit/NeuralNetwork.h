@@ -0,0 +1,198 @@
+#ifndef NEURALNETWORK_H
+#define NEURALNETWORK_H
+
+#include "DenseNetwork.h"
+#include "CsvLoader.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Classifier used by main.cpp: one hidden layer of sigmoid neurons and one sigmoid output
+// per class, trained on one-hot targets. A thin wrapper around DenseNetwork.
+//
+// Dataset rows are the input values followed by the class index (0..n_outputs-1).
+// Training reads rows through a DataView, gathering one batch at a time, so folds and
+// subsets of one shared matrix need no copies. Each Network owns all of its state, so
+// separate Networks can train on separate threads.
+//
+// With checkpoint_path and checkpoint_every set, train() saves the network every that
+// many epochs; load_checkpoint() picks it up again, mapped, ready for predict() or for
+// more training.
+//
+// predict_batch() classifies many rows at once: predict_tile rows go through the network
+// per matrix product, and with a JobSystem the tiles are spread over its threads. Every
+// thread keeps its own tile buffers between calls, so several threads may call it on the
+// same Network at once.
+
+class Network {
+public:
+	int batch_size = 4; // Samples per gradient step
+	std::string checkpoint_path; // Where train() saves, if checkpoint_every > 0
+	size_t checkpoint_every = 0; // Epochs
+	size_t epochs_trained = 0;   // Since initialization, carried through checkpoints
+	int predict_tile = 256;      // Rows per forward pass in predict_batch()
+	JobSystem* jobs = nullptr;   // Threads for predict_batch(), if set
+
+	// Weights are seeded from rand(), so srand() picks the initialization
+	void initialize_network(int n_inputs, int n_hidden, int n_outputs) {
+		initialize_network(n_inputs, n_hidden, n_outputs, static_cast<unsigned int>(std::rand()));
+	}
+
+	void initialize_network(int n_inputs, int n_hidden, int n_outputs, unsigned int seed) {
+		net.Initialize({ n_inputs, n_hidden, n_outputs }, ACTIVATION_SIGMOID, ACTIVATION_SIGMOID, seed);
+		epochs_trained = 0;
+	}
+
+	bool save_checkpoint(const std::string& path, std::string* error = nullptr) const {
+		return net.Save(path.c_str(), epochs_trained, error);
+	}
+
+	bool load_checkpoint(const std::string& path, std::string* error = nullptr) {
+		if (!net.Load(path.c_str(), error)) {
+			return false;
+		}
+		epochs_trained = static_cast<size_t>(net.Progress());
+		return true;
+	}
+
+	// Mini-batch gradient descent over the rows in order, n_epoch times
+	void train(const DataView& rows, float l_rate, size_t n_epoch, size_t n_outputs) {
+		int n_inputs = net.Inputs();
+		int stride = PadDenseWidth(n_inputs);
+		int targetStride = PadDenseWidth(static_cast<int>(n_outputs));
+		inputs.assign(batch_size * stride, 0.0f);
+		targets.assign(batch_size * targetStride, 0.0f);
+
+		for (size_t e = 0; e < n_epoch; e++) {
+			for (int r = 0; r < rows.count; r += batch_size) {
+				int batch = std::min(batch_size, rows.count - r);
+				// Gather the batch's inputs and one-hot targets
+				std::fill(targets.begin(), targets.end(), 0.0f);
+				for (int b = 0; b < batch; b++) {
+					std::copy(rows.Row(r + b), rows.Row(r + b) + n_inputs, inputs.begin() + b * stride);
+					targets[b * targetStride + static_cast<int>(rows.Label(r + b))] = 1.0f;
+				}
+				net.TrainBatch(inputs.data(), stride, targets.data(), targetStride, batch, l_rate);
+			}
+			epochs_trained++;
+			if (checkpoint_every > 0 && epochs_trained % checkpoint_every == 0 && !checkpoint_path.empty()) {
+				std::string error;
+				if (!save_checkpoint(checkpoint_path, &error)) {
+					std::cerr << "Checkpoint failed: " << error << std::endl;
+				}
+			}
+		}
+	}
+
+	void train(const std::vector<std::vector<float>>& trainings_data, float l_rate, size_t n_epoch, size_t n_outputs) {
+		DataMatrix data;
+		data.rows = static_cast<int>(trainings_data.size());
+		data.cols = data.rows ? static_cast<int>(trainings_data[0].size()) : 0;
+		std::vector<int> order(data.rows);
+		for (int r = 0; r < data.rows; r++) {
+			data.values.insert(data.values.end(), trainings_data[r].begin(), trainings_data[r].end());
+			order[r] = r;
+		}
+		train(DataView{ &data, order.data(), data.rows }, l_rate, n_epoch, n_outputs);
+	}
+
+	// Index of the strongest output for one row; a trailing class column is ignored
+	int predict(const std::vector<float>& input) {
+		return predict(input.data());
+	}
+
+	int predict(const float* input) {
+		const float* output = net.Forward(input, net.Inputs(), 1);
+		return static_cast<int>(std::max_element(output, output + net.Outputs()) - output);
+	}
+
+	// Class of each of n rows into out[0..n). Row k starts at rows + k * stride; a stride
+	// of 0 means the rows hold just the inputs.
+	void predict_batch(const float* rows, size_t n, int* out, size_t stride = 0) {
+		if (stride == 0) {
+			stride = net.Inputs();
+		}
+		for_each_tile(n, [&](size_t begin, int count, Scratch& scratch) {
+			const float* output = net.Forward(rows + begin * stride, static_cast<int>(stride), count, scratch.workspace);
+			store_classes(output, count, out + begin);
+		});
+	}
+
+	// Same for the rows of a view, gathered into a tile buffer first
+	void predict_batch(const DataView& rows, int* out) {
+		int n_inputs = net.Inputs();
+		for_each_tile(rows.count, [&](size_t begin, int count, Scratch& scratch) {
+			scratch.rows.resize(static_cast<size_t>(count) * n_inputs);
+			for (int k = 0; k < count; k++) {
+				const float* row = rows.Row(static_cast<int>(begin) + k);
+				std::copy(row, row + n_inputs, scratch.rows.begin() + static_cast<size_t>(k) * n_inputs);
+			}
+			const float* output = net.Forward(scratch.rows.data(), n_inputs, count, scratch.workspace);
+			store_classes(output, count, out + begin);
+		});
+	}
+
+	void display_human() {
+		std::cout << "[Network] (Layers: " << net.LayerCount() << ")" << std::endl;
+		for (int l = 0; l < net.LayerCount(); l++) {
+			std::cout << "{" << std::endl << "\t[Layer] (Neurons: " << net.Size(l + 1) << ")" << std::endl;
+			for (int o = 0; o < net.Size(l + 1); o++) {
+				std::cout << "\t{" << std::endl << "\t\t[Neuron] (Weights: " << net.Size(l) << ")" << std::endl << "\t\t";
+				for (int i = 0; i < net.Size(l); i++) std::cout << net.Weight(l, i, o) << " ";
+				std::cout << std::endl << "\t\t(Bias: " << net.Bias(l, o) << ")" << std::endl << "\t}" << std::endl;
+			}
+			std::cout << "}" << std::endl;
+		}
+	}
+
+	DenseNetwork net;
+
+private:
+	// Buffers for one predict_batch() tile
+	struct Scratch {
+		DenseWorkspace workspace;
+		std::vector<float> rows;
+	};
+
+	// One set per thread, shared by every Network: a thread runs one tile at a time. Slots
+	// of the JobSystem would not do, threads outside the pool all get slot 0.
+	static Scratch& thread_scratch() {
+		static thread_local Scratch scratch;
+		return scratch;
+	}
+
+	// fn(first row, row count, scratch) for each tile of n rows, on the JobSystem if set
+	template <typename Fn>
+	void for_each_tile(size_t n, const Fn& fn) {
+		int tile = std::max(predict_tile, 1);
+		int tiles = static_cast<int>((n + tile - 1) / tile);
+		auto run = [&](int begin, int end) {
+			Scratch& mine = thread_scratch();
+			for (int t = begin; t < end; t++) {
+				size_t first = static_cast<size_t>(t) * tile;
+				fn(first, static_cast<int>(std::min<size_t>(tile, n - first)), mine);
+			}
+		};
+		if (jobs) {
+			jobs->ParallelFor(0, tiles, 1, run);
+		} else {
+			run(0, tiles);
+		}
+	}
+
+	// Index of the strongest output of each row
+	void store_classes(const float* output, int count, int* out) const {
+		int stride = net.OutputStride(), n_outputs = net.Outputs();
+		for (int k = 0; k < count; k++) {
+			const float* row = output + k * stride;
+			out[k] = static_cast<int>(std::max_element(row, row + n_outputs) - row);
+		}
+	}
+
+	std::vector<float> inputs, targets; // One batch, gathered
+};
+
+#endif // NEURALNETWORK_H
@@ -0,0 +1,111 @@
+#ifndef PARTICLEBUFFER_H
+#define PARTICLEBUFFER_H
+
+#include "raylib.h"
+#include <mm_malloc.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+// Every particle array is aligned to and padded up to a whole AVX register, so SIMD
+// kernels can run over PaddedCount() elements without a scalar tail loop
+const int particleAlignment = 32;  // Bytes
+const int particleLanes = 8;       // Floats per AVX register
+
+inline int PadParticleCount(int count) {
+    return (count + particleLanes - 1) / particleLanes * particleLanes;
+}
+
+// Fixed-capacity aligned array; growing keeps the existing contents, new elements are zeroed
+template <typename T>
+class AlignedArray {
+public:
+    AlignedArray() = default;
+    ~AlignedArray() { _mm_free(data); }
+    AlignedArray(const AlignedArray&) = delete;
+    AlignedArray& operator=(const AlignedArray&) = delete;
+    AlignedArray(AlignedArray&& other) noexcept { swap(other); }
+    AlignedArray& operator=(AlignedArray&& other) noexcept { swap(other); return *this; }
+
+    void Reserve(int count) {
+        if (count <= capacity) return;
+        int newCapacity = std::max(PadParticleCount(count), 2 * capacity);
+        T* grown = static_cast<T*>(_mm_malloc(sizeof(T) * newCapacity, particleAlignment));
+        if (capacity > 0) memcpy(grown, data, sizeof(T) * capacity);
+        memset(grown + capacity, 0, sizeof(T) * (newCapacity - capacity));
+        _mm_free(data);
+        data = grown;
+        capacity = newCapacity;
+    }
+
+    void swap(AlignedArray& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(capacity, other.capacity);
+    }
+
+    T& operator[](int i) { return data[i]; }
+    const T& operator[](int i) const { return data[i]; }
+    T* Data() { return data; }
+    const T* Data() const { return data; }
+
+private:
+    T* data = nullptr;
+    int capacity = 0;
+};
+
+// Structure-of-arrays particle storage: positions and velocities live in separate float
+// arrays so integration kernels stream through them one SIMD register at a time
+class ParticleBuffer {
+public:
+    int Count() const { return count; }
+    int PaddedCount() const { return PadParticleCount(count); }
+
+    void Reserve(int capacity) {
+        x.Reserve(capacity); y.Reserve(capacity);
+        vx.Reserve(capacity); vy.Reserve(capacity);
+        previousX.Reserve(capacity); previousY.Reserve(capacity);
+        color.Reserve(capacity);
+    }
+
+    void Resize(int newCount) {
+        Reserve(newCount);
+        count = newCount;
+    }
+
+    void Clear() { count = 0; }
+
+    int Add(Vector2 position, Vector2 velocity, Color c) {
+        Reserve(count + 1);
+        x[count] = position.x; y[count] = position.y;
+        vx[count] = velocity.x; vy[count] = velocity.y;
+        previousX[count] = position.x; previousY[count] = position.y;
+        color[count] = c;
+        return count++;
+    }
+
+    Vector2 Position(int i) const { return { x[i], y[i] }; }
+    Vector2 Velocity(int i) const { return { vx[i], vy[i] }; }
+
+    // Position blended between the previous step (alpha = 0) and the current one (alpha = 1)
+    Vector2 Interpolated(int i, float alpha) const {
+        return { previousX[i] + (x[i] - previousX[i]) * alpha, previousY[i] + (y[i] - previousY[i]) * alpha };
+    }
+
+    void swap(ParticleBuffer& other) noexcept {
+        x.swap(other.x); y.swap(other.y);
+        vx.swap(other.vx); vy.swap(other.vy);
+        previousX.swap(other.previousX); previousY.swap(other.previousY);
+        color.swap(other.color);
+        std::swap(count, other.count);
+    }
+
+    AlignedArray<float> x, y;    // Position, pixels
+    AlignedArray<float> vx, vy;  // Velocity, pixels/second
+    AlignedArray<float> previousX, previousY;  // Position before the last step, for render interpolation
+    AlignedArray<Color> color;
+
+private:
+    int count = 0;
+};
+
+#endif // PARTICLEBUFFER_H
@@ -0,0 +1,200 @@
+#ifndef PARTICLEKERNELS_H
+#define PARTICLEKERNELS_H
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define PARTICLE_KERNELS_X86
+    #include <immintrin.h>
+#endif
+
+// Per-step integration kernels over structure-of-arrays particle data, in scalar, SSE2
+// and AVX2 flavors. ParticleKernels::Get() picks the widest one the CPU supports at
+// runtime, so one binary runs everywhere and still uses AVX2 where it exists.
+//
+// The SIMD versions process whole registers: n must be padded to a multiple of 8 (see
+// PadParticleCount() in ParticleBuffer.h) and the arrays aligned to 32 bytes.
+
+enum SimdLevel {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2,
+    SIMD_AVX2
+};
+
+struct IntegrateParams {
+    float gravityX, gravityY;      // Pixels/second^2
+    float damping;                 // Velocity scale per step (1 = no drag)
+    float dt;                      // Seconds
+    float minX, minY, maxX, maxY;  // Allowed particle centers (walls minus radius)
+};
+
+//----------------------------------------------------------------------------------
+// Scalar reference kernels
+//----------------------------------------------------------------------------------
+
+// Gravity and drag: v = (v + g*dt)*damping, then integrate and clamp to the walls: out = clamp(p + v*dt)
+static inline void PredictScalar(const float* x, const float* y, float* vx, float* vy,
+                                 float* outX, float* outY, int n, const IntegrateParams& p) {
+    for (int i = 0; i < n; i++) {
+        vx[i] = (vx[i] + p.gravityX * p.dt) * p.damping;
+        vy[i] = (vy[i] + p.gravityY * p.dt) * p.damping;
+        outX[i] = std::min(std::max(x[i] + vx[i] * p.dt, p.minX), p.maxX);
+        outY[i] = std::min(std::max(y[i] + vy[i] * p.dt, p.minY), p.maxY);
+    }
+}
+
+// Keep positions inside the walls
+static inline void ClampScalar(float* x, float* y, int n, const IntegrateParams& p) {
+    for (int i = 0; i < n; i++) {
+        x[i] = std::min(std::max(x[i], p.minX), p.maxX);
+        y[i] = std::min(std::max(y[i], p.minY), p.maxY);
+    }
+}
+
+// Velocity from the solved positions: v = (new - old)/dt, then old = new
+static inline void UpdateVelocityScalar(float* x, float* y, const float* newX, const float* newY,
+                                        float* vx, float* vy, int n, float invDt) {
+    for (int i = 0; i < n; i++) {
+        vx[i] = (newX[i] - x[i]) * invDt;
+        vy[i] = (newY[i] - y[i]) * invDt;
+        x[i] = newX[i];
+        y[i] = newY[i];
+    }
+}
+
+#if defined(PARTICLE_KERNELS_X86)
+//----------------------------------------------------------------------------------
+// SSE2 kernels (baseline on x86-64), 4 particles per iteration
+//----------------------------------------------------------------------------------
+static inline void PredictSSE2(const float* x, const float* y, float* vx, float* vy,
+                               float* outX, float* outY, int n, const IntegrateParams& p) {
+    const __m128 gx = _mm_set1_ps(p.gravityX * p.dt), gy = _mm_set1_ps(p.gravityY * p.dt);
+    const __m128 damping = _mm_set1_ps(p.damping), dt = _mm_set1_ps(p.dt);
+    const __m128 minX = _mm_set1_ps(p.minX), maxX = _mm_set1_ps(p.maxX);
+    const __m128 minY = _mm_set1_ps(p.minY), maxY = _mm_set1_ps(p.maxY);
+    for (int i = 0; i < n; i += 4) {
+        __m128 vxi = _mm_mul_ps(_mm_add_ps(_mm_load_ps(vx + i), gx), damping);
+        __m128 vyi = _mm_mul_ps(_mm_add_ps(_mm_load_ps(vy + i), gy), damping);
+        __m128 px = _mm_add_ps(_mm_load_ps(x + i), _mm_mul_ps(vxi, dt));
+        __m128 py = _mm_add_ps(_mm_load_ps(y + i), _mm_mul_ps(vyi, dt));
+        _mm_store_ps(vx + i, vxi);
+        _mm_store_ps(vy + i, vyi);
+        _mm_store_ps(outX + i, _mm_min_ps(_mm_max_ps(px, minX), maxX));
+        _mm_store_ps(outY + i, _mm_min_ps(_mm_max_ps(py, minY), maxY));
+    }
+}
+
+static inline void ClampSSE2(float* x, float* y, int n, const IntegrateParams& p) {
+    const __m128 minX = _mm_set1_ps(p.minX), maxX = _mm_set1_ps(p.maxX);
+    const __m128 minY = _mm_set1_ps(p.minY), maxY = _mm_set1_ps(p.maxY);
+    for (int i = 0; i < n; i += 4) {
+        _mm_store_ps(x + i, _mm_min_ps(_mm_max_ps(_mm_load_ps(x + i), minX), maxX));
+        _mm_store_ps(y + i, _mm_min_ps(_mm_max_ps(_mm_load_ps(y + i), minY), maxY));
+    }
+}
+
+static inline void UpdateVelocitySSE2(float* x, float* y, const float* newX, const float* newY,
+                                      float* vx, float* vy, int n, float invDt) {
+    const __m128 scale = _mm_set1_ps(invDt);
+    for (int i = 0; i < n; i += 4) {
+        __m128 nx = _mm_load_ps(newX + i), ny = _mm_load_ps(newY + i);
+        _mm_store_ps(vx + i, _mm_mul_ps(_mm_sub_ps(nx, _mm_load_ps(x + i)), scale));
+        _mm_store_ps(vy + i, _mm_mul_ps(_mm_sub_ps(ny, _mm_load_ps(y + i)), scale));
+        _mm_store_ps(x + i, nx);
+        _mm_store_ps(y + i, ny);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// AVX2/FMA kernels, 8 particles per iteration. Compiled for AVX2 through the target
+// attribute, so the rest of the program does not need -mavx2.
+//----------------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static inline void PredictAVX2(const float* x, const float* y, float* vx, float* vy,
+                               float* outX, float* outY, int n, const IntegrateParams& p) {
+    const __m256 gx = _mm256_set1_ps(p.gravityX * p.dt), gy = _mm256_set1_ps(p.gravityY * p.dt);
+    const __m256 damping = _mm256_set1_ps(p.damping), dt = _mm256_set1_ps(p.dt);
+    const __m256 minX = _mm256_set1_ps(p.minX), maxX = _mm256_set1_ps(p.maxX);
+    const __m256 minY = _mm256_set1_ps(p.minY), maxY = _mm256_set1_ps(p.maxY);
+    for (int i = 0; i < n; i += 8) {
+        __m256 vxi = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(vx + i), gx), damping);
+        __m256 vyi = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(vy + i), gy), damping);
+        __m256 px = _mm256_fmadd_ps(vxi, dt, _mm256_load_ps(x + i));
+        __m256 py = _mm256_fmadd_ps(vyi, dt, _mm256_load_ps(y + i));
+        _mm256_store_ps(vx + i, vxi);
+        _mm256_store_ps(vy + i, vyi);
+        _mm256_store_ps(outX + i, _mm256_min_ps(_mm256_max_ps(px, minX), maxX));
+        _mm256_store_ps(outY + i, _mm256_min_ps(_mm256_max_ps(py, minY), maxY));
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static inline void ClampAVX2(float* x, float* y, int n, const IntegrateParams& p) {
+    const __m256 minX = _mm256_set1_ps(p.minX), maxX = _mm256_set1_ps(p.maxX);
+    const __m256 minY = _mm256_set1_ps(p.minY), maxY = _mm256_set1_ps(p.maxY);
+    for (int i = 0; i < n; i += 8) {
+        _mm256_store_ps(x + i, _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(x + i), minX), maxX));
+        _mm256_store_ps(y + i, _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(y + i), minY), maxY));
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static inline void UpdateVelocityAVX2(float* x, float* y, const float* newX, const float* newY,
+                                      float* vx, float* vy, int n, float invDt) {
+    const __m256 scale = _mm256_set1_ps(invDt);
+    for (int i = 0; i < n; i += 8) {
+        __m256 nx = _mm256_load_ps(newX + i), ny = _mm256_load_ps(newY + i);
+        _mm256_store_ps(vx + i, _mm256_mul_ps(_mm256_sub_ps(nx, _mm256_load_ps(x + i)), scale));
+        _mm256_store_ps(vy + i, _mm256_mul_ps(_mm256_sub_ps(ny, _mm256_load_ps(y + i)), scale));
+        _mm256_store_ps(x + i, nx);
+        _mm256_store_ps(y + i, ny);
+    }
+}
+#endif // PARTICLE_KERNELS_X86
+
+//----------------------------------------------------------------------------------
+// Runtime dispatch
+//----------------------------------------------------------------------------------
+struct ParticleKernels {
+    SimdLevel level;
+    void (*Predict)(const float* x, const float* y, float* vx, float* vy, float* outX, float* outY, int n, const IntegrateParams& p);
+    void (*Clamp)(float* x, float* y, int n, const IntegrateParams& p);
+    void (*UpdateVelocity)(float* x, float* y, const float* newX, const float* newY, float* vx, float* vy, int n, float invDt);
+
+    // Widest instruction set this CPU supports
+    static SimdLevel Detect() {
+#if defined(PARTICLE_KERNELS_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SIMD_AVX2;
+        return SIMD_SSE2;
+#else
+        return SIMD_SCALAR;
+#endif
+    }
+
+    // Kernels for a given level, falling back to the widest supported one below it
+    static ParticleKernels For(SimdLevel level) {
+        level = std::min(level, Detect());
+#if defined(PARTICLE_KERNELS_X86)
+        if (level == SIMD_AVX2) return { SIMD_AVX2, PredictAVX2, ClampAVX2, UpdateVelocityAVX2 };
+        if (level == SIMD_SSE2) return { SIMD_SSE2, PredictSSE2, ClampSSE2, UpdateVelocitySSE2 };
+#endif
+        return { SIMD_SCALAR, PredictScalar, ClampScalar, UpdateVelocityScalar };
+    }
+
+    // Best kernels for this CPU, detected once
+    static const ParticleKernels& Get() {
+        static const ParticleKernels best = For(SIMD_AVX2);
+        return best;
+    }
+
+    static const char* Name(SimdLevel level) {
+        switch (level) {
+            case SIMD_AVX2: return "AVX2";
+            case SIMD_SSE2: return "SSE2";
+            default: return "scalar";
+        }
+    }
+};
+
+#endif // PARTICLEKERNELS_H
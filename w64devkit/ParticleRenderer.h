@@ -0,0 +1,159 @@
+#ifndef PARTICLERENDERER_H
+#define PARTICLERENDERER_H
+
+#include "raylib.h"
+#include "include/rlgl.h"
+#include "include/raymath.h"
+#include "ParticleBuffer.h"
+
+// Draws every particle of a ParticleBuffer with one instanced draw call.
+//
+// The SoA arrays are uploaded as they are (x, y, previous x, previous y and color each
+// go to their own instance buffer), so there is no per-particle CPU work at all: each
+// instance expands a unit quad in the vertex shader, where the position is also
+// interpolated between steps, and the fragment shader cuts an anti-aliased circle out
+// of the quad. Compare with DrawCircleV(), which tessellates ~36 triangles per particle
+// into rlgl's immediate-mode batch and flushes it every few thousand particles.
+//
+// Needs desktop OpenGL 3.3 or 4.3; on other contexts Draw() falls back to DrawCircleV().
+// Load() after InitWindow(), Unload() before CloseWindow().
+class ParticleRenderer {
+public:
+    bool Load() {
+        // The shaders are GLSL 330: ES 2.0/3.0 contexts take the fallback too
+        int version = rlGetVersion();
+        if (version != RL_OPENGL_33 && version != RL_OPENGL_43) return false;
+
+        // rlLoadShaderCode() hands back the default shader when compiling or linking fails
+        shader = rlLoadShaderCode(vertexShader, fragmentShader);
+        if (shader == 0 || shader == rlGetShaderIdDefault()) {
+            shader = 0;
+            return false;
+        }
+        mvpLoc = rlGetLocationUniform(shader, "mvp");
+        radiusLoc = rlGetLocationUniform(shader, "radius");
+        alphaLoc = rlGetLocationUniform(shader, "alpha");
+        cornerLoc = rlGetLocationAttrib(shader, "vertexCorner");
+        for (int a = 0; a < instanceAttribs; a++) instanceLoc[a] = rlGetLocationAttrib(shader, attribNames[a]);
+
+        // Two triangles covering [-1, 1]^2
+        static const float corners[12] = { -1, -1, 1, -1, 1, 1, -1, -1, 1, 1, -1, 1 };
+        vao = rlLoadVertexArray();
+        rlEnableVertexArray(vao);
+        quad = rlLoadVertexBuffer(corners, sizeof(corners), false);
+        rlSetVertexAttribute(cornerLoc, 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(cornerLoc);
+        rlDisableVertexArray();
+        return true;
+    }
+
+    void Unload() {
+        if (shader == 0) return;
+        for (unsigned int& vbo : instanceVbo) if (vbo != 0) rlUnloadVertexBuffer(vbo);
+        rlUnloadVertexBuffer(quad);
+        rlUnloadVertexArray(vao);
+        rlUnloadShaderProgram(shader);
+        *this = ParticleRenderer();
+    }
+
+    bool Instanced() const { return shader != 0; }
+
+    // Draw at the positions blended between the previous and current step (alpha in [0, 1]).
+    // Call between BeginDrawing()/EndDrawing(), in the current camera/transform.
+    void Draw(const ParticleBuffer& particles, float radius, float alpha = 1.0f) {
+        int count = particles.Count();
+        if (count == 0) return;
+        if (shader == 0) {
+            for (int i = 0; i < count; i++) DrawCircleV(particles.Interpolated(i, alpha), radius, particles.color[i]);
+            return;
+        }
+
+        if (count > capacity) Reserve(count);
+        const void* sources[instanceAttribs] = {
+            particles.x.Data(), particles.y.Data(), particles.previousX.Data(), particles.previousY.Data(), particles.color.Data()
+        };
+        for (int a = 0; a < instanceAttribs; a++) rlUpdateVertexBuffer(instanceVbo[a], sources[a], count * 4, 0);
+
+        // Anything already queued in the batch goes first, so the particles layer on top of it
+        rlDrawRenderBatchActive();
+
+        rlEnableShader(shader);
+        rlSetUniformMatrix(mvpLoc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+        rlSetUniform(radiusLoc, &radius, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(alphaLoc, &alpha, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlEnableVertexArray(vao);
+        rlDrawVertexArrayInstanced(0, 6, count);
+        rlDisableVertexArray();
+        rlDisableShader();
+    }
+
+private:
+    static const int instanceAttribs = 5;
+
+    // Instance buffers are sized for the largest count seen so far; the x/y/previous
+    // arrays are floats and colors are 4 bytes, so every buffer holds 4 bytes per particle
+    void Reserve(int count) {
+        capacity = PadParticleCount(count + count / 2);
+        rlEnableVertexArray(vao);
+        for (int a = 0; a < instanceAttribs; a++) {
+            if (instanceVbo[a] != 0) rlUnloadVertexBuffer(instanceVbo[a]);
+            instanceVbo[a] = rlLoadVertexBuffer(nullptr, capacity * 4, true);
+            bool color = (a == instanceAttribs - 1);
+            rlSetVertexAttribute(instanceLoc[a], color ? 4 : 1, color ? RL_UNSIGNED_BYTE : RL_FLOAT, color, 0, 0);
+            rlSetVertexAttributeDivisor(instanceLoc[a], 1);
+            rlEnableVertexAttribute(instanceLoc[a]);
+        }
+        rlDisableVertexArray();
+    }
+
+    static constexpr const char* attribNames[instanceAttribs] = {
+        "instanceX", "instanceY", "instancePreviousX", "instancePreviousY", "instanceColor"
+    };
+
+    static constexpr const char* vertexShader =
+        "#version 330\n"
+        "in vec2 vertexCorner;\n"
+        "in float instanceX;\n"
+        "in float instanceY;\n"
+        "in float instancePreviousX;\n"
+        "in float instancePreviousY;\n"
+        "in vec4 instanceColor;\n"
+        "uniform mat4 mvp;\n"
+        "uniform float radius;\n"
+        "uniform float alpha;\n"
+        "out vec2 corner;\n"
+        "out vec4 color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec2 center = mix(vec2(instancePreviousX, instancePreviousY), vec2(instanceX, instanceY), alpha);\n"
+        "    corner = vertexCorner;\n"
+        "    color = instanceColor;\n"
+        "    gl_Position = mvp*vec4(center + vertexCorner*radius, 0.0, 1.0);\n"
+        "}\n";
+
+    // Circle as a distance test on the quad, with a one-pixel soft edge
+    static constexpr const char* fragmentShader =
+        "#version 330\n"
+        "in vec2 corner;\n"
+        "in vec4 color;\n"
+        "out vec4 finalColor;\n"
+        "void main()\n"
+        "{\n"
+        "    float d = length(corner);\n"
+        "    float edge = fwidth(d);\n"
+        "    float coverage = 1.0 - smoothstep(1.0 - edge, 1.0, d);\n"
+        "    if (coverage <= 0.0) discard;\n"
+        "    finalColor = vec4(color.rgb, color.a*coverage);\n"
+        "}\n";
+
+    unsigned int shader = 0;
+    unsigned int vao = 0;
+    unsigned int quad = 0;
+    unsigned int instanceVbo[instanceAttribs] = {};
+    int instanceLoc[instanceAttribs] = {};
+    int cornerLoc = -1;
+    int mvpLoc = -1, radiusLoc = -1, alphaLoc = -1;
+    int capacity = 0;
+};
+
+#endif // PARTICLERENDERER_H
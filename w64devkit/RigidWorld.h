@@ -0,0 +1,329 @@
+#ifndef RIGIDWORLD_H
+#define RIGIDWORLD_H
+
+#include "raylib.h"
+#include "JobSystem.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Small 2D rigid-body engine: bodies, revolute (pin) joints and distance joints (rigid
+// rods, or ropes that can go slack), solved with sequential impulses at a fixed time
+// step, in pixels and seconds.
+//
+// Each Step() integrates gravity, damping and applied forces into the velocities, then
+// runs `iterations` passes over the joints, each correcting the relative velocity at its
+// anchors with an impulse (Baumgarte feedback pulls drifted anchors back together).
+// Joint impulses are kept between steps and applied up front (warm starting), so the
+// solver starts from last step's answer and converges in a few iterations even for
+// chains of joints.
+//
+// Joints are stored contiguously and grouped by island (sets of bodies linked by
+// joints), so with a JobSystem the islands are solved in parallel: no two islands touch
+// the same dynamic body. Static bodies (mass 0) never move and are shared freely.
+
+struct RigidBody {
+    Vector2 position;          // Center of mass, pixels
+    float angle;               // Radians
+    Vector2 velocity;          // Pixels/second
+    float angularVelocity;     // Radians/second
+    float invMass;             // 0 for static bodies
+    float invInertia;          // 0 for static bodies
+    float linearDamping;       // Fraction of the velocity lost per second (about)
+    float angularDamping;
+    Vector2 force;             // Accumulated until the next Step(), then cleared
+    float torque;
+};
+
+enum JointType {
+    JOINT_REVOLUTE = 0,   // Anchors pinned together, free rotation
+    JOINT_DISTANCE,       // Anchors kept at a fixed distance (rigid rod)
+    JOINT_ROPE            // Anchors kept no farther apart than the length (string)
+};
+
+struct RigidJoint {
+    JointType type;
+    int bodyA, bodyB;
+    Vector2 localA, localB;    // Anchors relative to each body's center, unrotated
+    float length;              // Distance and rope joints
+
+    // Solver state
+    Vector2 impulse;           // Accumulated over the step, reused to warm start the next one
+    Vector2 rA, rB;            // Anchors rotated into world space
+    Vector2 axis;              // Distance and rope: unit vector from anchor A to anchor B
+    Vector2 bias;              // Velocity that feeds the position error back
+    float k11, k12, k22;       // Inverse effective mass (2x2 for revolute, k11 for the others)
+};
+
+class RigidWorld {
+public:
+    explicit RigidWorld(Vector2 gravity = { 0.0f, 0.0f }, float timeStep = 1.0f / 60.0f, int iterations = 8, JobSystem* jobs = nullptr)
+        : gravity(gravity), timeStep(timeStep), iterations(iterations), jobs(jobs) {
+        ground = AddBody({ 0, 0 }, 0.0f, 0.0f);
+    }
+
+    // Add a body; mass 0 makes it static. Returns its index.
+    int AddBody(Vector2 position, float mass, float inertia, float angle = 0.0f) {
+        RigidBody body = {};
+        body.position = position;
+        body.angle = angle;
+        body.invMass = (mass > 0.0f) ? 1.0f / mass : 0.0f;
+        body.invInertia = (inertia > 0.0f) ? 1.0f / inertia : 0.0f;
+        bodies.push_back(body);
+        islandsDirty = true;
+        return static_cast<int>(bodies.size()) - 1;
+    }
+
+    static float DiskInertia(float mass, float radius) { return 0.5f * mass * radius * radius; }
+
+    // Pin bodies a and b together at a world point (b = Ground() pins a to the world)
+    int AddRevoluteJoint(int a, int b, Vector2 anchor) {
+        return AddJoint(JOINT_REVOLUTE, a, b, anchor, anchor);
+    }
+
+    // Keep two world points on bodies a and b at their current distance. A rope only
+    // stops them from moving farther apart.
+    int AddDistanceJoint(int a, int b, Vector2 anchorA, Vector2 anchorB, bool rope = false) {
+        return AddJoint(rope ? JOINT_ROPE : JOINT_DISTANCE, a, b, anchorA, anchorB);
+    }
+
+    // Advance one fixed time step
+    void Step() {
+        float dt = timeStep;
+        if (islandsDirty) BuildIslands();
+
+        // Forces and damping into the velocities
+        ForRanges(static_cast<int>(bodies.size()), bodyGrain, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                RigidBody& b = bodies[i];
+                if (b.invMass == 0.0f && b.invInertia == 0.0f) continue;
+                b.velocity.x += dt * (gravity.x + b.invMass * b.force.x);
+                b.velocity.y += dt * (gravity.y + b.invMass * b.force.y);
+                b.angularVelocity += dt * b.invInertia * b.torque;
+                float linear = 1.0f / (1.0f + dt * b.linearDamping);
+                float angular = 1.0f / (1.0f + dt * b.angularDamping);
+                b.velocity.x *= linear; b.velocity.y *= linear;
+                b.angularVelocity *= angular;
+            }
+        });
+
+        // Joints, one island per task
+        ForRanges(static_cast<int>(islandStart.size()) - 1, islandGrain, [&](int begin, int end) {
+            for (int island = begin; island < end; island++) {
+                int first = islandStart[island], last = islandStart[island + 1];
+                for (int j = first; j < last; j++) PrepareJoint(joints[j], dt);
+                for (int it = 0; it < iterations; it++) {
+                    for (int j = first; j < last; j++) SolveJoint(joints[j]);
+                }
+            }
+        });
+
+        // Velocities into the positions
+        ForRanges(static_cast<int>(bodies.size()), bodyGrain, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                RigidBody& b = bodies[i];
+                b.position.x += dt * b.velocity.x;
+                b.position.y += dt * b.velocity.y;
+                b.angle += dt * b.angularVelocity;
+                b.force = { 0, 0 };
+                b.torque = 0.0f;
+            }
+        });
+    }
+
+    // A point given relative to a body's center (unrotated) in world space
+    Vector2 WorldPoint(int body, Vector2 local) const {
+        const RigidBody& b = bodies[body];
+        Vector2 r = Rotate(local, b.angle);
+        return { b.position.x + r.x, b.position.y + r.y };
+    }
+
+    // Apply a force at a world point until the next Step()
+    void ApplyForce(int body, Vector2 force, Vector2 point) {
+        RigidBody& b = bodies[body];
+        b.force.x += force.x; b.force.y += force.y;
+        b.torque += Cross({ point.x - b.position.x, point.y - b.position.y }, force);
+    }
+
+    RigidBody& Body(int i) { return bodies[i]; }
+    const RigidBody& Body(int i) const { return bodies[i]; }
+    int BodyCount() const { return static_cast<int>(bodies.size()); }
+    int Ground() const { return ground; }
+
+    // Joints move when the islands are rebuilt, so they are addressed by the id AddJoint() returned
+    RigidJoint& Joint(int id) { return joints[jointSlot[id]]; }
+    const RigidJoint& Joint(int id) const { return joints[jointSlot[id]]; }
+    int JointCount() const { return static_cast<int>(joints.size()); }
+    int IslandCount() const { return static_cast<int>(islandStart.size()) - 1; }
+
+    Vector2 gravity;
+    float timeStep;
+    int iterations;
+
+private:
+    static const int bodyGrain = 4096;
+    static const int islandGrain = 64;
+    static constexpr float baumgarte = 0.2f;   // Fraction of the position error fixed per step
+
+    static Vector2 Rotate(Vector2 v, float angle) {
+        float c = cosf(angle), s = sinf(angle);
+        return { c * v.x - s * v.y, s * v.x + c * v.y };
+    }
+    static float Cross(Vector2 a, Vector2 b) { return a.x * b.y - a.y * b.x; }
+
+    int AddJoint(JointType type, int a, int b, Vector2 anchorA, Vector2 anchorB) {
+        RigidJoint joint = {};
+        joint.type = type;
+        joint.bodyA = a;
+        joint.bodyB = b;
+        const RigidBody &A = bodies[a], &B = bodies[b];
+        joint.localA = Rotate({ anchorA.x - A.position.x, anchorA.y - A.position.y }, -A.angle);
+        joint.localB = Rotate({ anchorB.x - B.position.x, anchorB.y - B.position.y }, -B.angle);
+        float dx = anchorB.x - anchorA.x, dy = anchorB.y - anchorA.y;
+        joint.length = sqrtf(dx * dx + dy * dy);
+        joints.push_back(joint);
+        jointSlot.push_back(static_cast<int>(joints.size()) - 1);
+        jointId.push_back(static_cast<int>(jointSlot.size()) - 1);
+        islandsDirty = true;
+        return static_cast<int>(jointSlot.size()) - 1;
+    }
+
+    template <typename Fn>
+    void ForRanges(int count, int grain, const Fn& fn) {
+        if (jobs) jobs->ParallelFor(0, count, grain, fn);
+        else fn(0, count);
+    }
+
+    int Find(int i) {
+        while (parent[i] != i) i = parent[i] = parent[parent[i]];
+        return i;
+    }
+
+    // Union the dynamic bodies of every joint, then counting-sort the joints by island
+    // so each island's joints are one contiguous range
+    void BuildIslands() {
+        int bodyCount = static_cast<int>(bodies.size());
+        int jointCount = static_cast<int>(joints.size());
+        parent.resize(bodyCount);
+        for (int i = 0; i < bodyCount; i++) parent[i] = i;
+        auto dynamic = [&](int i) { return bodies[i].invMass != 0.0f || bodies[i].invInertia != 0.0f; };
+        for (const RigidJoint& j : joints) {
+            if (dynamic(j.bodyA) && dynamic(j.bodyB)) parent[Find(j.bodyA)] = Find(j.bodyB);
+        }
+
+        // Island number per root body, in order of first appearance
+        std::vector<int> islandOf(bodyCount, -1);
+        std::vector<int> jointIsland(jointCount);
+        int islands = 0;
+        for (int j = 0; j < jointCount; j++) {
+            int root = Find(dynamic(joints[j].bodyA) ? joints[j].bodyA : joints[j].bodyB);
+            if (islandOf[root] < 0) islandOf[root] = islands++;
+            jointIsland[j] = islandOf[root];
+        }
+
+        islandStart.assign(islands + 1, 0);
+        for (int j = 0; j < jointCount; j++) islandStart[jointIsland[j] + 1]++;
+        for (int i = 0; i < islands; i++) islandStart[i + 1] += islandStart[i];
+
+        std::vector<int> cursor(islandStart.begin(), islandStart.end() - 1);
+        std::vector<RigidJoint> grouped(jointCount);
+        std::vector<int> groupedId(jointCount);
+        for (int j = 0; j < jointCount; j++) {
+            int slot = cursor[jointIsland[j]]++;
+            grouped[slot] = joints[j];
+            groupedId[slot] = jointId[j];
+            jointSlot[jointId[j]] = slot;
+        }
+        joints.swap(grouped);
+        jointId.swap(groupedId);
+        islandsDirty = false;
+    }
+
+    // Anchor arms, effective mass and bias for this step, then the warm start impulse
+    void PrepareJoint(RigidJoint& j, float dt) {
+        const RigidBody &A = bodies[j.bodyA], &B = bodies[j.bodyB];
+        j.rA = Rotate(j.localA, A.angle);
+        j.rB = Rotate(j.localB, B.angle);
+        float mA = A.invMass, mB = B.invMass, iA = A.invInertia, iB = B.invInertia;
+        Vector2 d = { B.position.x + j.rB.x - A.position.x - j.rA.x, B.position.y + j.rB.y - A.position.y - j.rA.y };
+
+        if (j.type == JOINT_REVOLUTE) {
+            // K = [mA + mB + iA*rAy^2 + iB*rBy^2, -iA*rAx*rAy - iB*rBx*rBy; ..., mA + mB + iA*rAx^2 + iB*rBx^2]
+            float a = mA + mB + iA * j.rA.y * j.rA.y + iB * j.rB.y * j.rB.y;
+            float b = -iA * j.rA.x * j.rA.y - iB * j.rB.x * j.rB.y;
+            float c = mA + mB + iA * j.rA.x * j.rA.x + iB * j.rB.x * j.rB.x;
+            float det = a * c - b * b;
+            float invDet = (det != 0.0f) ? 1.0f / det : 0.0f;
+            j.k11 = c * invDet; j.k12 = -b * invDet; j.k22 = a * invDet;
+            j.bias = { -baumgarte / dt * d.x, -baumgarte / dt * d.y };
+        } else {
+            float len = sqrtf(d.x * d.x + d.y * d.y);
+            j.axis = (len > 1e-6f) ? Vector2{ d.x / len, d.y / len } : Vector2{ 1.0f, 0.0f };
+            float crA = Cross(j.rA, j.axis), crB = Cross(j.rB, j.axis);
+            float k = mA + mB + iA * crA * crA + iB * crB * crB;
+            j.k11 = (k > 0.0f) ? 1.0f / k : 0.0f;
+            float error = len - j.length;
+            // A slack rope may close the gap within this step, but not overshoot it
+            j.bias.x = (j.type == JOINT_ROPE && error < 0.0f) ? -error / dt : -baumgarte / dt * error;
+            if (j.type == JOINT_ROPE && error < 0.0f) j.impulse = { 0, 0 };
+        }
+
+        Vector2 P = (j.type == JOINT_REVOLUTE) ? j.impulse : Vector2{ j.axis.x * j.impulse.x, j.axis.y * j.impulse.x };
+        ApplyImpulse(j, P);
+    }
+
+    void SolveJoint(RigidJoint& j) {
+        const RigidBody &A = bodies[j.bodyA], &B = bodies[j.bodyB];
+        // Relative velocity of anchor B with respect to anchor A: v + w x r
+        Vector2 dv = {
+            B.velocity.x - B.angularVelocity * j.rB.y - A.velocity.x + A.angularVelocity * j.rA.y,
+            B.velocity.y + B.angularVelocity * j.rB.x - A.velocity.y - A.angularVelocity * j.rA.x
+        };
+
+        Vector2 P;
+        if (j.type == JOINT_REVOLUTE) {
+            Vector2 e = { j.bias.x - dv.x, j.bias.y - dv.y };
+            P = { j.k11 * e.x + j.k12 * e.y, j.k12 * e.x + j.k22 * e.y };
+            j.impulse.x += P.x; j.impulse.y += P.y;
+        } else {
+            float cdot = dv.x * j.axis.x + dv.y * j.axis.y;
+            float lambda = j.k11 * (j.bias.x - cdot);
+            if (j.type == JOINT_ROPE) {
+                // A rope only pulls: the accumulated impulse stays <= 0
+                float old = j.impulse.x;
+                j.impulse.x = std::min(old + lambda, 0.0f);
+                lambda = j.impulse.x - old;
+            } else {
+                j.impulse.x += lambda;
+            }
+            P = { j.axis.x * lambda, j.axis.y * lambda };
+        }
+        ApplyImpulse(j, P);
+    }
+
+    // Impulse P on B at rB and -P on A at rA. Static bodies are left alone, which also
+    // keeps parallel islands from writing to a shared ground body.
+    void ApplyImpulse(const RigidJoint& j, Vector2 P) {
+        RigidBody &A = bodies[j.bodyA], &B = bodies[j.bodyB];
+        if (A.invMass != 0.0f || A.invInertia != 0.0f) {
+            A.velocity.x -= A.invMass * P.x; A.velocity.y -= A.invMass * P.y;
+            A.angularVelocity -= A.invInertia * Cross(j.rA, P);
+        }
+        if (B.invMass != 0.0f || B.invInertia != 0.0f) {
+            B.velocity.x += B.invMass * P.x; B.velocity.y += B.invMass * P.y;
+            B.angularVelocity += B.invInertia * Cross(j.rB, P);
+        }
+    }
+
+    std::vector<RigidBody> bodies;
+    std::vector<RigidJoint> joints;   // Grouped by island
+    std::vector<int> jointSlot;       // Joint id -> index in joints
+    std::vector<int> jointId;         // Index in joints -> joint id
+    std::vector<int> islandStart;     // Island i owns joints [islandStart[i], islandStart[i + 1])
+    std::vector<int> parent;          // Union-find scratch
+    int ground = 0;
+    bool islandsDirty = true;
+    JobSystem* jobs = nullptr;        // Not owned; null runs everything on the calling thread
+};
+
+#endif // RIGIDWORLD_H
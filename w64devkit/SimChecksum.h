@@ -0,0 +1,25 @@
+#ifndef SIMCHECKSUM_H
+#define SIMCHECKSUM_H
+
+#include <cstdint>
+#include <cstddef>
+
+// FNV-1a hash of raw simulation state. Floats are hashed bit for bit, so two runs only
+// match if they computed exactly the same values: any change to the math, the order of
+// operations or the compiler flags shows up as a different checksum.
+struct SimChecksum {
+    uint64_t hash = 14695981039346656037ull;
+
+    void Add(const void* data, size_t bytes) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < bytes; i++) {
+            hash ^= p[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    template <typename T>
+    void Add(const T& value) { Add(&value, sizeof(T)); }
+};
+
+#endif // SIMCHECKSUM_H
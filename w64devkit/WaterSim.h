@@ -0,0 +1,97 @@
+#ifndef WATERSIM_H
+#define WATERSIM_H
+
+#include "raylib.h"
+#include "FluidSolver.h"
+#include "SimChecksum.h"
+#include <algorithm>
+#include <cmath>
+
+// Simulation core of waterphy.cpp: a glass of SPH water that the mouse pushes around.
+// It does no drawing and reads no input, so the headless benchmark can step it without
+// a window.
+class WaterSim {
+public:
+    static constexpr float particleRadius = 4.0f;
+    static constexpr float gravity = 1800.0f;          // Pixels/second^2
+    static constexpr float interactionRadius = 15.0f;
+    static constexpr float mouseRepel = 90.0f;         // Velocity change per step near the mouse, pixels/second
+    static constexpr float timeStep = 1.0f / 60.0f;    // Fixed simulation step
+
+    // Fill the lower half of `glass` row by row, `count` particles (0 = the whole lower half).
+    // `simd` caps the solver's integration kernels; results depend on it (AVX2 uses FMA).
+    WaterSim(Rectangle glass, int count = 0, JobSystem* jobs = nullptr, SimdLevel simd = SIMD_AVX2)
+        : glass(glass), solver(glass, Params(simd), jobs) {
+        float spacing = particleRadius * 2;
+        int rows = static_cast<int>(glass.height / spacing);
+        int cols = static_cast<int>(glass.width / spacing);
+        if (count <= 0) count = cols * (rows / 2);
+        particles.Reserve(count);
+        for (int i = 0; particles.Count() < count; i++) {
+            for (int j = 0; j < cols && particles.Count() < count; j++) {
+                Vector2 position = { glass.x + j * spacing + particleRadius, glass.y + glass.height / 2 + i * spacing };
+                particles.Add(position, { 0, 0 }, BLUE); // Water color
+            }
+        }
+    }
+
+    // A glass as tall as waterphy.cpp's (300 px), wide enough that its lower half holds
+    // `count` particles. The water depth stays the same, so the work per particle does too.
+    static Rectangle GlassFor(int count) {
+        float spacing = particleRadius * 2;
+        float height = 300.0f;
+        int rows = static_cast<int>(height / spacing) / 2;
+        int cols = std::max(1, (count + rows - 1) / rows);
+        return { 0, 0, cols * spacing, height };
+    }
+
+    // Apply the mouse and advance one fixed step
+    void Step(Vector2 mousePos) {
+        ApplyForces(mousePos);
+        solver.Step(particles, timeStep);
+    }
+
+    uint64_t Checksum() const {
+        SimChecksum sum;
+        int n = particles.Count();
+        sum.Add(particles.x.Data(), sizeof(float) * n);
+        sum.Add(particles.y.Data(), sizeof(float) * n);
+        sum.Add(particles.vx.Data(), sizeof(float) * n);
+        sum.Add(particles.vy.Data(), sizeof(float) * n);
+        return sum.hash;
+    }
+
+    int Count() const { return particles.Count(); }
+    const FluidSolver& Solver() const { return solver; }
+
+    Rectangle glass;
+    ParticleBuffer particles;
+
+private:
+    static FluidParams Params(SimdLevel simd) {
+        FluidParams params;
+        params.simd = simd;
+        params.restSpacing = particleRadius * 2;
+        params.particleRadius = particleRadius;
+        params.gravity = { 0.0f, gravity };
+        return params;
+    }
+
+    // Push particles away from the mouse; gravity, pressure and viscosity are handled by the solver
+    void ApplyForces(Vector2 mousePos) {
+        for (int i = 0; i < particles.Count(); i++) {
+            float dx = mousePos.x - particles.x[i];
+            float dy = mousePos.y - particles.y[i];
+            float distanceSq = dx * dx + dy * dy;
+            if (distanceSq < interactionRadius * interactionRadius && distanceSq > 0.0f) {
+                float scale = -mouseRepel / sqrtf(distanceSq);
+                particles.vx[i] += dx * scale;
+                particles.vy[i] += dy * scale;
+            }
+        }
+    }
+
+    FluidSolver solver;
+};
+
+#endif // WATERSIM_H
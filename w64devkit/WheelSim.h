@@ -0,0 +1,137 @@
+#ifndef WHEELSIM_H
+#define WHEELSIM_H
+
+#include "raylib.h"
+#include "RigidWorld.h"
+#include "SimChecksum.h"
+#include <vector>
+#include <cmath>
+
+// Simulation core of wheel1.cpp and mech.cpp: a wheel on a fixed axle with a weight
+// hanging from a pin on its rim by a string. Holding the left button grabs the pin with
+// a second, elastic string to the mouse, so dragging the mouse turns the wheel. mech.cpp
+// adds gravity on the weight and axle friction.
+//
+// Built on RigidWorld at a fixed 60 Hz step, so the motion no longer depends on the
+// frame rate. A sim can hold any number of independent mechanisms (the headless
+// benchmark runs thousands); each one is its own island in the solver.
+
+struct WheelParams {
+    float gravity = 0.0f;              // Pixels/second^2 on the weight (mech.cpp: 981, 9.81 m/s^2 at 100 px/m)
+    float frictionCoefficient = 0.0f;  // Extra fraction of the wheel's spin lost per second at the axle (mech.cpp: 3)
+};
+
+// The mouse, as far as one wheel is concerned
+struct WheelInput {
+    bool pulling;      // Left button held
+    Vector2 mouse;     // Screen position of the mouse
+};
+
+class WheelSim {
+public:
+    static constexpr float wheelRadius = 50.0f;
+    static constexpr float crankLength = 100.0f;     // Weight's initial distance from the axle
+    static constexpr float massRadius = 10.0f;
+    static constexpr float wheelMass = 20.0f;
+    static constexpr float weightMass = 5.0f;
+    static constexpr float dampingFactor = 1.2f;     // Fraction of the wheel's spin lost per second
+    static constexpr float tensionFactor = 3500.0f;  // Force per pixel the held string is stretched
+    static constexpr float stringDamping = 190.0f;   // Force per pixel/second of stretching
+    static constexpr float timeStep = 1.0f / 60.0f;
+
+    WheelSim(Vector2 center, const WheelParams& params = WheelParams(), int count = 1, JobSystem* jobs = nullptr)
+        : world({ 0.0f, 0.0f }, timeStep, 8, jobs) {
+        for (int k = 0; k < count; k++) {
+            Mechanism m = {};
+            m.handLength = -1.0f;
+            m.wheel = world.AddBody(center, wheelMass, RigidWorld::DiskInertia(wheelMass, wheelRadius));
+            world.Body(m.wheel).angularDamping = dampingFactor + params.frictionCoefficient;
+            world.AddRevoluteJoint(m.wheel, world.Ground(), center);
+
+            // Weight on a string from the pin at angle 0 on the rim
+            Vector2 pin = { center.x + wheelRadius, center.y };
+            m.weight = world.AddBody({ center.x + crankLength, center.y }, weightMass,
+                                     RigidWorld::DiskInertia(weightMass, massRadius));
+            m.string = world.AddDistanceJoint(m.wheel, m.weight, pin, world.Body(m.weight).position, true);
+            mechanisms.push_back(m);
+        }
+        inputs.assign(count, WheelInput{ false, { 0, 0 } });
+        gravity = params.gravity;
+    }
+
+    void SetInput(int k, const WheelInput& input) { inputs[k] = input; }
+
+    // Advance every mechanism by one fixed step with the inputs last set
+    void Step() {
+        for (int k = 0; k < Count(); k++) {
+            Mechanism& m = mechanisms[k];
+            if (inputs[k].pulling) PullString(m, inputs[k].mouse);
+            else m.handLength = -1.0f;
+            world.Body(m.weight).force = { 0.0f, gravity * weightMass };
+        }
+        world.Step();
+    }
+
+    int Count() const { return static_cast<int>(mechanisms.size()); }
+
+    Vector2 Center(int k) const { return world.Body(mechanisms[k].wheel).position; }
+    float Angle(int k) const { return world.Body(mechanisms[k].wheel).angle; }
+    float AngularVelocity(int k) const { return world.Body(mechanisms[k].wheel).angularVelocity; } // Radians/second
+    Vector2 Pin(int k) const { return world.WorldPoint(mechanisms[k].wheel, { wheelRadius, 0.0f }); }
+    Vector2 MassPosition(int k) const { return world.Body(mechanisms[k].weight).position; }
+    bool Pulling(int k) const { return inputs[k].pulling; }
+    Vector2 Mouse(int k) const { return inputs[k].mouse; }
+
+    // Current distance from the pin to the weight
+    float StringLength(int k) const {
+        Vector2 pin = Pin(k), weight = MassPosition(k);
+        return sqrtf((weight.x - pin.x) * (weight.x - pin.x) + (weight.y - pin.y) * (weight.y - pin.y));
+    }
+
+    uint64_t Checksum() const {
+        SimChecksum sum;
+        for (int i = 0; i < world.BodyCount(); i++) {
+            const RigidBody& b = world.Body(i);
+            sum.Add(b.position);
+            sum.Add(b.angle);
+            sum.Add(b.velocity);
+            sum.Add(b.angularVelocity);
+        }
+        return sum.hash;
+    }
+
+    RigidWorld world;
+
+private:
+    struct Mechanism {
+        int wheel, weight;   // Bodies
+        int string;          // Joint
+        float handLength;    // Unstretched length of the held string, -1 when not held
+    };
+
+    // The held string runs from the mouse to the pin. The hand takes up slack as the pin
+    // comes closer and pulls on it like a stiff spring when it moves away. A force rather
+    // than a joint, so dragging farther than the wheel can follow cannot break the axle.
+    void PullString(Mechanism& m, Vector2 mouse) {
+        Vector2 pin = world.WorldPoint(m.wheel, { wheelRadius, 0.0f });
+        Vector2 d = { mouse.x - pin.x, mouse.y - pin.y };
+        float length = sqrtf(d.x * d.x + d.y * d.y);
+        m.handLength = (m.handLength < 0.0f) ? length : std::min(m.handLength, length);
+        if (length < 1e-3f) return;
+
+        // Stretch rate from the pin's velocity along the string
+        const RigidBody& wheel = world.Body(m.wheel);
+        Vector2 u = { d.x / length, d.y / length };
+        Vector2 r = { pin.x - wheel.position.x, pin.y - wheel.position.y };
+        Vector2 v = { wheel.velocity.x - wheel.angularVelocity * r.y, wheel.velocity.y + wheel.angularVelocity * r.x };
+        float stretchRate = -(v.x * u.x + v.y * u.y);
+        float tension = std::max(tensionFactor * (length - m.handLength) + stringDamping * stretchRate, 0.0f);
+        world.ApplyForce(m.wheel, { u.x * tension, u.y * tension }, pin);
+    }
+
+    std::vector<Mechanism> mechanisms;
+    std::vector<WheelInput> inputs;
+    float gravity = 0.0f;
+};
+
+#endif // WHEELSIM_H
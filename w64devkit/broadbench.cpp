@@ -0,0 +1,110 @@
+#include "raylib.h"
+#include "Broadphase.h"
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Benchmark the broadphase methods on moving circles, followed by the
+// CheckCollisionCircles narrowphase.
+// Usage: broadbench [bodies] [frames]
+// Bodies get radii of 2-6 px and are spread so each box overlaps about one other.
+// Up to bruteForceLimit bodies, both methods are checked against an all-pairs loop.
+
+const int bruteForceLimit = 20000;
+const float spacing = 16.0f; // Average distance between body centers
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<CollisionPair> BruteForcePairs(const std::vector<Rectangle>& boxes) {
+    std::vector<CollisionPair> pairs;
+    int count = static_cast<int>(boxes.size());
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            const Rectangle &a = boxes[i], &b = boxes[j];
+            if (a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height) pairs.push_back({ i, j });
+        }
+    }
+    return pairs;
+}
+
+bool SamePairs(std::vector<CollisionPair> a, std::vector<CollisionPair> b) {
+    auto less = [](const CollisionPair& p, const CollisionPair& q) { return p.a < q.a || (p.a == q.a && p.b < q.b); };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].a != b[i].a || a[i].b != b[i].b) return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int count = (argc > 1) ? atoi(argv[1]) : 50000;
+    int frames = (argc > 2) ? atoi(argv[2]) : 60;
+
+    float side = std::sqrt(static_cast<float>(count)) * spacing;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, side), size(2.0f, 6.0f), speed(-2.0f, 2.0f);
+    std::vector<Vector2> centers(count), velocities(count);
+    std::vector<float> radii(count);
+    for (int i = 0; i < count; i++) {
+        centers[i] = { coord(rng), coord(rng) };
+        velocities[i] = { speed(rng), speed(rng) };
+        radii[i] = size(rng);
+    }
+
+    std::vector<Rectangle> boxes(count);
+    auto bounds = [&](int i) { return boxes[i]; };
+    auto circles = [&](int a, int b) { return CheckCollisionCircles(centers[a], radii[a], centers[b], radii[b]); };
+
+    printf("bodies: %d  frames: %d\n", count, frames);
+    bool ok = true;
+    for (BroadphaseMethod method : { BROADPHASE_SWEEP_AND_PRUNE, BROADPHASE_GRID }) {
+        Broadphase broadphase(method);
+        std::vector<CollisionPair> pairs;
+        double broadTime = 0.0, narrowTime = 0.0;
+        size_t boxPairs = 0, contacts = 0;
+
+        std::vector<Vector2> position = centers, velocity = velocities;
+        for (int f = 0; f < frames; f++) {
+            // Drift and bounce off the edges, then refresh the boxes
+            for (int i = 0; i < count; i++) {
+                centers[i].x += velocities[i].x;
+                centers[i].y += velocities[i].y;
+                if (centers[i].x < 0 || centers[i].x > side) velocities[i].x = -velocities[i].x;
+                if (centers[i].y < 0 || centers[i].y > side) velocities[i].y = -velocities[i].y;
+                float r = radii[i];
+                boxes[i] = { centers[i].x - r, centers[i].y - r, 2 * r, 2 * r };
+            }
+
+            auto start = Clock::now();
+            broadphase.FindPairs(count, bounds, pairs);
+            broadTime += Seconds(start);
+            boxPairs = pairs.size();
+
+            if (f == frames - 1 && count <= bruteForceLimit && !SamePairs(pairs, BruteForcePairs(boxes))) ok = false;
+
+            start = Clock::now();
+            NarrowPhase(pairs, circles);
+            narrowTime += Seconds(start);
+            contacts = pairs.size();
+        }
+        centers = position; // Same motion for the next method
+        velocities = velocity;
+
+        printf("%-16s broadphase %7.3f ms  narrowphase %7.3f ms  box pairs: %zu  contacts: %zu\n",
+               method == BROADPHASE_GRID ? "grid:" : "sweep and prune:",
+               broadTime * 1e3 / frames, narrowTime * 1e3 / frames, boxPairs, contacts);
+    }
+
+    if (count <= bruteForceLimit) printf("%s\n", ok ? "pairs match brute force" : "PAIR MISMATCH");
+    else printf("brute force check: skipped (more than %d bodies)\n", bruteForceLimit);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include "DenseNetwork.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Save a DenseNetwork checkpoint and time how long a fresh network takes from Load() to
+// its first prediction, against reading the same file into memory with fread().
+// Usage: checkpointbench [hidden width] [file]
+// The network is 784 inputs, two hidden layers of the given width and 10 outputs. The
+// file (default checkpointbench.nn) is left in place.
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int width = (argc > 1) ? atoi(argv[1]) : 1024;
+    const char* path = (argc > 2) ? argv[2] : "checkpointbench.nn";
+    const int inputs = 784, outputs = 10, batch = 32;
+
+    // A few training steps, so the weights are not just the initialization
+    DenseNetwork net({ inputs, width, width, outputs }, ACTIVATION_RELU, ACTIVATION_SIGMOID, 3);
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> value(0.0f, 1.0f);
+    std::vector<float> x(batch * inputs), t(batch * outputs, 0.0f);
+    for (float& v : x) v = value(rng);
+    for (int b = 0; b < batch; b++) t[b * outputs + rng() % outputs] = 1.0f;
+    for (int s = 0; s < 5; s++) net.TrainBatch(x.data(), inputs, t.data(), outputs, batch, 0.1f);
+    std::vector<float> expected(net.Forward(x.data(), inputs, 1), net.Forward(x.data(), inputs, 1) + outputs);
+
+    auto start = Clock::now();
+    std::string error;
+    if (!net.Save(path, 5, &error)) {
+        printf("save failed: %s\n", error.c_str());
+        return 1;
+    }
+    double saveTime = Seconds(start);
+    printf("network: %d-%d-%d-%d  parameters: %d (%.1f MB)  save: %.2f ms\n", inputs, width, width, outputs,
+           net.ParameterCount(), net.ParameterCount() * 4 / 1e6, saveTime * 1e3);
+
+    // Mapped: the weights are paged in by the first Forward()
+    start = Clock::now();
+    DenseNetwork loaded;
+    if (!loaded.Load(path, &error)) {
+        printf("load failed: %s\n", error.c_str());
+        return 1;
+    }
+    double mapTime = Seconds(start);
+    const float* output = loaded.Forward(x.data(), inputs, 1);
+    double mappedFirst = Seconds(start);
+
+    bool same = loaded.Mapped() && loaded.Progress() == 5;
+    for (int o = 0; o < outputs; o++) same = same && output[o] == expected[o];
+
+    // Read into memory instead, as a loader without mapping would
+    start = Clock::now();
+    FILE* file = fopen(path, "rb");
+    std::vector<char> bytes;
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        bytes.resize(ftell(file));
+        fseek(file, 0, SEEK_SET);
+        if (fread(bytes.data(), 1, bytes.size(), file) != bytes.size()) bytes.clear();
+        fclose(file);
+    }
+    double readTime = Seconds(start);
+
+    // Training a loaded network moves the weights into its own memory first
+    loaded.TrainBatch(x.data(), inputs, t.data(), outputs, batch, 0.1f);
+    net.TrainBatch(x.data(), inputs, t.data(), outputs, batch, 0.1f);
+    same = same && !loaded.Mapped() && memcmp(loaded.Parameters(), net.Parameters(), sizeof(float) * net.ParameterCount()) == 0;
+
+    printf("load (map + header):      %9.3f ms\n", mapTime * 1e3);
+    printf("load + first prediction:  %9.3f ms\n", mappedFirst * 1e3);
+    printf("fread of the whole file:  %9.3f ms\n", readTime * 1e3);
+    printf("%s\n", same ? "outputs and training match the saved network" : "MISMATCH");
+    return same ? 0 : 1;
+}
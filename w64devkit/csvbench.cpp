@@ -0,0 +1,105 @@
+#include "CsvLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+// Load time of CsvLoader against the std::regex/std::stof loader main.cpp used before,
+// on a generated file shaped like seeds_dataset.csv (7 features and a class column).
+// Usage: csvbench [rows] [file]
+// The file is written first (default csvbench.csv) and left in place. Both loaders
+// must produce the same normalized values.
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// The old loader, unchanged apart from its name
+std::vector<std::vector<float>> RegexLoad(std::string filename) {
+    const std::regex comma(",");
+    std::ifstream csv_file(filename);
+    std::vector<std::vector<float>> data;
+    std::string line;
+    std::vector<float> mins;
+    std::vector<float> maxs;
+    bool first = true;
+
+    while (csv_file && std::getline(csv_file, line)) {
+        std::vector<std::string> srow{ std::sregex_token_iterator(line.begin(), line.end(), comma, -1), std::sregex_token_iterator() };
+        std::vector<float> row(srow.size());
+        std::transform(srow.begin(), srow.end(), row.begin(), [](std::string const& val) { return std::stof(val); });
+        if (first) {
+            mins = row;
+            maxs = row;
+            first = false;
+        } else {
+            for (size_t t = 0; t < row.size(); t++) {
+                if (row[t] > maxs[t]) maxs[t] = row[t];
+                else if (row[t] < mins[t]) mins[t] = row[t];
+            }
+        }
+        data.push_back(row);
+    }
+    for (auto& vec : data) {
+        for (size_t i = 0; i < vec.size() - 1; i++) vec[i] = (vec[i] - mins[i]) / (maxs[i] - mins[i]);
+    }
+    return data;
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 1000000;
+    const char* path = (argc > 2) ? argv[2] : "csvbench.csv";
+
+    // Mixed formats: plain decimals, negatives and exponents
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        printf("cannot write %s\n", path);
+        return 1;
+    }
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> value(-50.0f, 50.0f);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < 7; c++) {
+            float v = value(rng);
+            if (c == 3) fprintf(out, "%.6e,", v * 1e-3f);
+            else fprintf(out, "%.4f,", v);
+        }
+        fprintf(out, "%d\n", static_cast<int>(rng() % 3) + 1);
+    }
+    long bytes = ftell(out);
+    fclose(out);
+    printf("rows: %d  file: %.1f MB\n", rows, bytes / 1e6);
+
+    auto start = Clock::now();
+    std::vector<std::vector<float>> old = RegexLoad(path);
+    double regexTime = Seconds(start);
+
+    start = Clock::now();
+    DataMatrix matrix;
+    std::vector<float> mins, maxs;
+    std::string error;
+    if (!LoadCsv(path, matrix, mins, maxs, &error)) {
+        printf("LoadCsv failed: %s\n", error.c_str());
+        return 1;
+    }
+    NormalizeColumns(matrix, mins, maxs, matrix.cols - 1);
+    double mappedTime = Seconds(start);
+
+    float worst = (static_cast<int>(old.size()) == matrix.rows) ? 0.0f : INFINITY;
+    for (int r = 0; r < matrix.rows && r < static_cast<int>(old.size()); r++) {
+        for (int c = 0; c < matrix.cols; c++) worst = std::max(worst, std::fabs(old[r][c] - matrix.At(r, c)));
+    }
+
+    printf("regex:   %8.3f s  %7.1f MB/s\n", regexTime, bytes / 1e6 / regexTime);
+    printf("mapped:  %8.3f s  %7.1f MB/s  %.1fx\n", mappedTime, bytes / 1e6 / mappedTime, regexTime / mappedTime);
+    printf("max difference: %g\n", worst);
+    return (worst < 1e-6f) ? 0 : 1;
+}
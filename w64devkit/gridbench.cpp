@@ -0,0 +1,79 @@
+#include "raylib.h"
+#include "NeighborGrid.h"
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Benchmark the NeighborGrid pair search against brute force.
+// Usage: gridbench [particles] [radius] [steps]
+// Particles are spread at a fixed density so every particle has about the same number
+// of neighbors at every size; brute force is skipped above bruteForceLimit particles.
+
+const int bruteForceLimit = 40000;
+const float spacing = 8.0f; // Average distance between particles (waterphy.cpp: 2*particleRadius)
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+long long BruteForcePairs(const std::vector<Vector2>& positions, float radius) {
+    float radiusSq = radius * radius;
+    long long pairs = 0;
+    int count = static_cast<int>(positions.size());
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            float dx = positions[j].x - positions[i].x;
+            float dy = positions[j].y - positions[i].y;
+            if (dx * dx + dy * dy < radiusSq) pairs++;
+        }
+    }
+    return pairs;
+}
+
+int main(int argc, char* argv[]) {
+    int count = (argc > 1) ? atoi(argv[1]) : 100000;
+    float radius = (argc > 2) ? static_cast<float>(atof(argv[2])) : 15.0f;
+    int steps = (argc > 3) ? atoi(argv[3]) : 10;
+
+    float side = std::sqrt(static_cast<float>(count)) * spacing;
+    Rectangle bounds = { 0, 0, side, side };
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, side);
+    std::vector<Vector2> positions(count);
+    for (auto& p : positions) p = { coord(rng), coord(rng) };
+    auto pos = [&](int i) { return positions[i]; };
+
+    NeighborGrid grid(bounds, radius);
+    long long gridPairs = 0;
+
+    auto start = Clock::now();
+    for (int s = 0; s < steps; s++) {
+        grid.Rebuild(count, pos);
+        gridPairs = 0;
+        grid.ForEachPair(radius, pos, [&](int, int, Vector2, float) { gridPairs++; });
+    }
+    double gridTime = Seconds(start) / steps;
+
+    printf("particles: %d  radius: %.1f  cells: %dx%d\n", count, radius, grid.Cols(), grid.Rows());
+    printf("grid:        %10.3f ms/step  %8.1f ns/particle  pairs: %lld\n",
+           gridTime * 1e3, gridTime * 1e9 / count, gridPairs);
+
+    if (count <= bruteForceLimit) {
+        start = Clock::now();
+        long long brutePairs = BruteForcePairs(positions, radius);
+        double bruteTime = Seconds(start);
+        printf("brute force: %10.3f ms/step  %8.1f ns/particle  pairs: %lld\n",
+               bruteTime * 1e3, bruteTime * 1e9 / count, brutePairs);
+        printf("speedup: %.1fx  %s\n", bruteTime / gridTime, (brutePairs == gridPairs) ? "pairs match" : "PAIR MISMATCH");
+        return (brutePairs == gridPairs) ? 0 : 1;
+    }
+
+    printf("brute force: skipped (more than %d particles)\n", bruteForceLimit);
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "raylib.h"
+#include "WaterSim.h"
+#include "WheelSim.h"
+#include "AsteroidSim.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+// Headless driver for the demo simulations: steps a sim for a fixed number of frames
+// with scripted input, without opening a window, and reports the speed and a checksum
+// of the final state. Same build, sim, frames, count and seed => same checksum, so the
+// checksum tells whether a change altered the results and the timings whether it made
+// them faster.
+// Usage: headless <water|wheel|mech|asteroids> [frames] [count] [threads] [seed] [simd]
+//   count: particles (water, 0 = the demo tub), wheels (wheel, mech) or asteroids
+//   threads: worker threads for the fluid and rigid-body solvers (results do not depend on it)
+//   simd: scalar, sse2 (default) or avx2, the widest fluid kernels to use. The AVX2 kernels
+//         use FMA and round differently, so water is pinned to SSE2 unless asked, which
+//         every x86-64 CPU has. The active path is printed next to the checksum: checksums
+//         are only comparable between runs that report the same path.
+// The sims call raylib's collision helpers, so link with -lraylib as for the demos.
+
+using Clock = std::chrono::steady_clock;
+
+struct RunResult {
+    int entities;       // What "per particle" is measured against
+    double seconds;     // Stepping time, without setup
+    uint64_t checksum;
+    const char* simd;   // Kernels the results depend on
+};
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Scripted inputs are pure integer functions of the frame and seed, so they cannot
+// differ between builds the way float math might.
+int PingPong(int t, int period) {
+    t %= 2 * period;
+    return (t < period) ? t : 2 * period - t;
+}
+
+RunResult RunWater(int frames, int count, int threads, unsigned seed, SimdLevel simd) {
+    Rectangle glass = (count > 0) ? WaterSim::GlassFor(count) : Rectangle{ 0, 0, 400, 300 };
+    JobSystem jobs(threads);
+    WaterSim sim(glass, count, &jobs, simd);
+
+    // The mouse sweeps back and forth through the water
+    int width = static_cast<int>(glass.width), height = static_cast<int>(glass.height);
+    int phase = static_cast<int>(seed % 1024);
+    auto start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        Vector2 mouse = { glass.x + PingPong(f * 7 + phase, width), glass.y + height / 2 + PingPong(f * 3 + phase, height / 2) };
+        sim.Step(mouse);
+    }
+    return { sim.Count(), Seconds(start), sim.Checksum(), ParticleKernels::Name(sim.Solver().Simd()) };
+}
+
+RunResult RunWheels(int frames, int count, int threads, unsigned seed, const WheelParams& params) {
+    if (count <= 0) count = 1;
+    JobSystem jobs(threads);
+    WheelSim sim({ 400, 300 }, params, count, &jobs);
+
+    // Every wheel gets grabbed and dragged around in bursts, with its own phase
+    int phase = static_cast<int>(seed % 1024);
+    auto start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (int k = 0; k < count; k++) {
+            int t = f + k * 17 + phase;
+            Vector2 mouse = { 250.0f + PingPong(t * 5, 300), 150.0f + PingPong(t * 3, 300) };
+            sim.SetInput(k, { (t / 45) % 2 == 0, mouse });
+        }
+        sim.Step();
+    }
+    return { count, Seconds(start), sim.Checksum(), "none" };
+}
+
+RunResult RunAsteroids(int frames, int count, unsigned seed) {
+    if (count <= 0) count = 5;
+
+    // Keep check.cpp's density of 5 asteroids per 800x600 screen
+    float scale = std::max(1.0f, std::sqrt(count / 5.0f));
+    AsteroidSim game(static_cast<int>(800 * scale), static_cast<int>(600 * scale), count, seed);
+
+    // Weave up and down, and restart right away after a crash
+    auto start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        bool up = (f / 40) % 2 == 0;
+        game.Step({ up, !up, game.gameOver });
+    }
+    return { count + 1, Seconds(start), game.Checksum(), "none" };
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printf("Usage: headless <water|wheel|mech|asteroids> [frames] [count] [threads] [seed] [scalar|sse2|avx2]\n");
+        return 1;
+    }
+    const char* name = argv[1];
+    int frames = (argc > 2) ? atoi(argv[2]) : 600;
+    int count = (argc > 3) ? atoi(argv[3]) : 0;
+    int threads = (argc > 4) ? atoi(argv[4]) : 1;
+    unsigned seed = (argc > 5) ? static_cast<unsigned>(strtoul(argv[5], nullptr, 10)) : 1;
+    const char* simdName = (argc > 6) ? argv[6] : "sse2";
+    SimdLevel simd = (strcmp(simdName, "avx2") == 0) ? SIMD_AVX2 : (strcmp(simdName, "scalar") == 0) ? SIMD_SCALAR : SIMD_SSE2;
+
+    RunResult result;
+    if (strcmp(name, "water") == 0) {
+        result = RunWater(frames, count, threads, seed, simd);
+    } else if (strcmp(name, "wheel") == 0) {
+        result = RunWheels(frames, count, threads, seed, WheelParams());
+    } else if (strcmp(name, "mech") == 0) {
+        WheelParams params;
+        params.gravity = 981.0f;
+        params.frictionCoefficient = 3.0f;
+        result = RunWheels(frames, count, threads, seed, params);
+    } else if (strcmp(name, "asteroids") == 0) {
+        result = RunAsteroids(frames, count, seed);
+    } else {
+        printf("Unknown sim: %s\n", name);
+        return 1;
+    }
+    double seconds = result.seconds;
+
+    printf("sim: %s  frames: %d  entities: %d  threads: %d  seed: %u\n", name, frames, result.entities, threads, seed);
+    printf("steps/s: %.1f  ns/particle: %.2f  total: %.3f s\n",
+           frames / seconds, seconds * 1e9 / (static_cast<double>(frames) * result.entities), seconds);
+    printf("checksum: %016llx  simd: %s\n", static_cast<unsigned long long>(result.checksum), result.simd);
+    return 0;
+}
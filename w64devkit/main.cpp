@@ -2,24 +2,29 @@
 #include <vector>
 #include <set>
 #include <string>
-#include <fstream>
-#include <regex>
-#include <iterator>
 #include <map>
 #include <numeric>
 #include <cmath>
+#include <ctime>
+#include <random>
 #include "NeuralNetwork.h"
+#include "CsvLoader.h"
+#include "CrossValidation.h"
+#include "HyperparameterSweep.h"
+#include "JobSystem.h"
 using namespace  std;
-std::vector<std::vector<float>> load_csv_data(std::string filename);
-std::vector<float> evaluate_network(std::vector<std::vector<float>> dataset, int n_folds, float l_rate, int n_epoch, int n_hidden);
-float accuracy_metric(std::vector<int> expect, std::vector<int> predict);
+DataMatrix load_csv_data(std::string filename);
+std::vector<float> evaluate_network(const DataMatrix& data, int n_folds, float l_rate, int n_epoch, int n_hidden, JobSystem& jobs, unsigned int seed);
+float accuracy_metric(const std::vector<int>& expect, const std::vector<int>& predict);
+int run_sweep(const DataMatrix& data, const char* spec_file, JobSystem& jobs);
 
 
 /*
 * This main function will load a csv-dataset and normalize the data. Subsequently, a network 
 * for this data will be initialized, trained and evaluated using cross-validation.
 * 
-* Feel free to play around with the folds, learning rate, epochs and hidden neurons.
+* Feel free to play around with the folds, learning rate, epochs and hidden neurons, or
+* pass a sweep spec (e.g. "main seeds_sweep.txt") to search for good values instead.
 * If you want to modify the network itself (activation function, additional layers, etc.)
 * you will want to look at NeuralNetwork.cpp.
 * 
@@ -28,33 +33,42 @@ float accuracy_metric(std::vector<int> expect, std::vector<int> predict);
 int main(int argc, char* argv[]) {
 	std::cout << "Neural Network with Backpropagation in C++ from scratch" << std::endl;
 
-	std::vector<std::vector<float>> csv_data;
-	csv_data = load_csv_data("seeds_dataset.csv");
-	
+	DataMatrix csv_data = load_csv_data("seeds_dataset.csv");
+	if (csv_data.rows == 0) {
+		return 1;
+	}
+
 	/*
 	* Normalize the last column (turning the outputs into values starting from 0 for the one-hot encoding in the end)
 	*/
 	std::map<int, int> lookup = {};
 	int index = 0;
-	for (auto& vec : csv_data) {
+	for (int r = 0; r < csv_data.rows; r++) {
+		float& label = csv_data.At(r, csv_data.cols - 1);
 		std::pair<std::map<int, int>::iterator, bool> ret;
 		// insert unique values
-		ret = lookup.insert(std::pair<int, int>(static_cast<int>(vec.back()),index));
-		// update the vector with the new index
-		vec.back() = static_cast<float>(ret.first->second);
+		ret = lookup.insert(std::pair<int, int>(static_cast<int>(label),index));
+		// update the row with the new index
+		label = static_cast<float>(ret.first->second);
 		// if an actual new value was found, increase the index
 		if (ret.second) {
 			index++;
 		}
 	}
 
+	JobSystem jobs;
+	if (argc > 1) {
+		return run_sweep(csv_data, argv[1], jobs);
+	}
+
 	int n_folds = 5;		// how many folds you want to create from the given dataset
 	float l_rate = 0.3f;	// how much of an impact shall an error have on a weight
 	int n_epoch = 500;		// how many times should weights be updated
 	int n_hidden = 5;		// how many neurons you want in the first layer
 
-	// test the implemented neural network
-	std::vector<float> scores = evaluate_network(csv_data, n_folds, l_rate, n_epoch, n_hidden);
+	// test the implemented neural network, one fold per thread
+	unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+	std::vector<float> scores = evaluate_network(csv_data, n_folds, l_rate, n_epoch, n_hidden, jobs, seed);
 
 	// calculate the mean average of the scores across each cross validation
 	float mean = std::accumulate(scores.begin(), scores.end(), decltype(scores)::value_type(0)) / static_cast<float>(scores.size());
@@ -64,88 +78,81 @@ int main(int argc, char* argv[]) {
 	return 0;
 }
 
-std::vector<float> evaluate_network(std::vector<std::vector<float>> dataset, int n_folds, float l_rate, int n_epoch, int n_hidden) {
+std::vector<float> evaluate_network(const DataMatrix& data, int n_folds, float l_rate, int n_epoch, int n_hidden, JobSystem& jobs, unsigned int seed) {
 
-	/* Split dataset into k folds */
-	
-	std::vector<std::vector<std::vector<float>>> dataset_splits;
-	// initialize prng
-	std::srand(static_cast<unsigned int>(std::time(nullptr)));
+	/* Split dataset into k folds (shuffled row indices, no copies) */
+	KFold folds(data, n_folds, seed);
+	int n_outputs = folds.Classes();
+	int n_inputs = folds.Inputs();
 
-	std::vector<float> scores;
-
-	size_t fold_size = static_cast<unsigned int>(dataset.size() / n_folds);
-	for (int f = 0; f < n_folds; f++)
-	{
-		std::vector<std::vector<float>> fold;
-		while (fold.size() < fold_size) {
-			int n = rand() % dataset.size(); // get a random index
-
-			// add the chosen element to the fold and remove it from the dataset
-			std::swap(dataset[n], dataset.back());
-			fold.push_back(dataset.back());
-			dataset.pop_back();
-		}
-
-		dataset_splits.push_back(fold);
-	}
-
-	/* Iterate over folds */
+	/* Train and test on each fold concurrently */
 	// choose one as test and the rest as training sets
-	for (size_t i = 0; i < dataset_splits.size(); i++)
-	{
-		std::vector<std::vector<std::vector<float>>> train_sets = dataset_splits;
-		std::swap(train_sets[i], train_sets.back());
-		std::vector<std::vector<float>> test_set = train_sets.back();
-		train_sets.pop_back();
-
-		// merge the multiple train_sets into one train set
-		std::vector<std::vector<float>> train_set;
-		for (auto &s: train_sets)
+	std::vector<float> scores(n_folds);
+	jobs.ParallelFor(0, n_folds, 1, [&](int begin, int end) {
+		for (int i = begin; i < end; i++)
 		{
-			for (auto& row : s) {
-				train_set.push_back(row);
-			}	
-		}
+			std::vector<int> train_rows = folds.TrainRows(i);
+			DataView train_set = folds.View(train_rows, 0, static_cast<int>(train_rows.size()));
+			DataView test_set = folds.Test(i);
+
+			/* Backpropagation with stochastic gradient descent */
+			// every fold has its own generator, so the result does not depend on which thread runs it
+			std::seed_seq fold_seed{ seed, static_cast<unsigned int>(i) };
+			std::mt19937 fold_rng(fold_seed);
+			Network network;
+			network.initialize_network(n_inputs, n_hidden, n_outputs, fold_rng());
+			network.train(train_set, l_rate, n_epoch, n_outputs);
+
+			// store the expected and predicted results
+			std::vector<int> expected(test_set.count), predicted(test_set.count);
+			for (int k = 0; k < test_set.count; k++)
+			{
+				expected[k] = static_cast<int>(test_set.Label(k));
+			}
+			network.predict_batch(test_set, predicted.data());
 
-		// store the expected results
-		std::vector<int> expected;
-		for (auto& row: test_set)
-		{
-			expected.push_back(static_cast<int>(row.back()));
-			// just ensure that the actual result is not saved in the test data
-			row.back() = 42;
+			scores[i] = accuracy_metric(expected, predicted);
 		}
+	});
 
-		std::vector<int> predicted;
-
-		std::set<float> results;
-		for (const auto& r : train_set) {
-			results.insert(r.back());
-		}
-		int n_outputs = results.size();
-		int n_inputs = train_set[0].size() - 1;
+	return scores;
+}
 
-		/* Backpropagation with stochastic gradient descent */
-		Network* network = new Network();
-		network->initialize_network(n_inputs, n_hidden, n_outputs);
-		network->train(train_set, l_rate, n_epoch, n_outputs);
+/*
+* Run the hyperparameter sweep described in a spec file (see HyperparameterSweep.h),
+* print the results and write them to the spec's output file
+*/
+int run_sweep(const DataMatrix& data, const char* spec_file, JobSystem& jobs) {
+	SweepSpec spec;
+	std::string error;
+	if (!LoadSweepSpec(spec_file, spec, &error)) {
+		std::cerr << "Failed to read " << spec_file << ": " << error << std::endl;
+		return 1;
+	}
 
-		for (const auto& row: test_set)
-		{
-			predicted.push_back(network->predict(row));
-		}
+	HyperparameterSweep sweep(data, spec);
+	std::vector<SweepResult> results = sweep.Run(jobs);
 
-		scores.push_back(accuracy_metric(expected, predicted));
+	std::printf("%8s %8s %8s %6s %8s %10s %8s %7s\n", "l_rate", "n_hidden", "n_epoch", "batch", "trained", "validation", "test", "stddev");
+	for (const SweepResult& r : results) {
+		std::printf("%8g %8d %8d %6d %8.0f %9.2f%% %7.2f%% %7.2f%s\n", r.config.lRate, r.config.hidden, r.config.epochs,
+		            r.config.batchSize, r.epochsTrained, r.validation, r.test, r.testSpread, r.stoppedEarly ? "  (stopped early)" : "");
 	}
+	std::printf("Epochs trained: %lld of %lld (%.1f%%)\n", sweep.TotalEpochs(), sweep.FullEpochs(),
+	            100.0 * sweep.TotalEpochs() / std::max(sweep.FullEpochs(), 1LL));
 
-	return scores;
+	if (!WriteSweepResults(spec.output.c_str(), results)) {
+		std::cerr << "Failed to write " << spec.output << std::endl;
+		return 1;
+	}
+	std::cout << "Results written to " << spec.output << std::endl;
+	return 0;
 }
 
 /* 
 * 
 */
-float accuracy_metric(std::vector<int> expect, std::vector<int> predict) {
+float accuracy_metric(const std::vector<int>& expect, const std::vector<int>& predict) {
 	int correct = 0;
 
 	for (size_t i = 0; i < predict.size(); i++)
@@ -159,58 +166,20 @@ float accuracy_metric(std::vector<int> expect, std::vector<int> predict) {
 
 /*
 * Load comma separated values from file and normalize the values
+* (every column but the last, which holds the class)
 */
-std::vector<std::vector<float>> load_csv_data(std::string filename) {
-	const std::regex comma(",");
-
-	std::ifstream csv_file(filename);
-
-	std::vector<std::vector<float>> data;
-
-	std::string line;
-
+DataMatrix load_csv_data(std::string filename) {
+	DataMatrix data;
 	std::vector<float> mins;
 	std::vector<float> maxs;
-	bool first = true;
-
-	while (csv_file && std::getline(csv_file, line)) {
-		// split line by commas
-		std::vector<std::string> srow{ std::sregex_token_iterator(line.begin(), line.end(), comma, -1), std::sregex_token_iterator() };
-		// create float vector
-		std::vector<float> row(srow.size());
-		// transform the strings to floats
-		std::transform(srow.begin(), srow.end(), row.begin(), [](std::string const& val) {return std::stof(val); });
-		
-		// keep track of the min and max value for each column for subsequent normalization
-		if (first) {
-			mins = row;
-			maxs = row;
-			first = false;
-		}
-		else {
-			for (size_t t=0; t < row.size(); t++)
-			{
-				if (row[t] > maxs[t]) {
-					maxs[t] = row[t];
-				}
-				else if (row[t] < mins[t]) {
-					mins[t] = row[t];
-				}
-			}
-		}
-
-		data.push_back(row);
-	}
+	std::string error;
 
-	// normalize values
-	for (auto& vec : data) {
-		// ignore the last column (the output)
-		for (size_t i = 0; i < vec.size()-1; i++)
-		{
-			vec[i] = (vec[i] - mins[i]) / (maxs[i] - mins[i]);
-		}
+	if (!LoadCsv(filename.c_str(), data, mins, maxs, &error)) {
+		std::cerr << "Failed to load " << filename << ": " << error << std::endl;
+		return DataMatrix();
 	}
 
+	NormalizeColumns(data, mins, maxs, data.cols - 1);
 	return data;
 }
 
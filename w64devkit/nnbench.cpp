@@ -0,0 +1,163 @@
+#include "DenseNetwork.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Training throughput of DenseNetwork against the per-sample, per-neuron loops NN.cpp
+// used before (one sample at a time, std::exp sigmoid).
+// Usage: nnbench [hidden width] [batch] [steps]
+// The network is 256 inputs, two hidden layers of the given width and 10 outputs.
+// Before timing, one training step of each kernel set is checked against the loops.
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// The old way: every neuron is a dot product over its inputs, one sample at a time
+struct PerSampleNetwork {
+    std::vector<int> sizes;
+    std::vector<std::vector<float>> weights, biases; // weights[l][o * inputs + i]
+    std::vector<std::vector<float>> outputs, errors;
+
+    explicit PerSampleNetwork(const DenseNetwork& net) {
+        for (int l = 0; l <= net.LayerCount(); l++) sizes.push_back(net.Size(l));
+        for (int l = 0; l < net.LayerCount(); l++) {
+            int in = sizes[l], out = sizes[l + 1];
+            weights.emplace_back(in * out);
+            biases.emplace_back(out);
+            for (int o = 0; o < out; o++) {
+                for (int i = 0; i < in; i++) weights[l][o * in + i] = net.Weight(l, i, o);
+                biases[l][o] = net.Bias(l, o);
+            }
+            outputs.emplace_back(out);
+            errors.emplace_back(out);
+        }
+    }
+
+    static float Sigmoid(float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+    void FeedForward(const float* input) {
+        const float* x = input;
+        for (size_t l = 0; l < weights.size(); l++) {
+            int in = sizes[l];
+            for (int o = 0; o < sizes[l + 1]; o++) {
+                float sum = biases[l][o];
+                for (int i = 0; i < in; i++) sum += weights[l][o * in + i] * x[i];
+                outputs[l][o] = Sigmoid(sum);
+            }
+            x = outputs[l].data();
+        }
+    }
+
+    // Mean gradient over the batch, accumulated sample by sample, then one step
+    void TrainBatch(const float* input, int inputStride, const float* target, int targetStride, int batch, float rate) {
+        std::vector<std::vector<float>> gw(weights.size()), gb(weights.size());
+        for (size_t l = 0; l < weights.size(); l++) {
+            gw[l].assign(weights[l].size(), 0.0f);
+            gb[l].assign(biases[l].size(), 0.0f);
+        }
+        for (int b = 0; b < batch; b++) {
+            const float* x0 = input + b * inputStride;
+            FeedForward(x0);
+            int last = static_cast<int>(weights.size()) - 1;
+            for (int o = 0; o < sizes[last + 1]; o++) {
+                float y = outputs[last][o];
+                errors[last][o] = (y - target[b * targetStride + o]) * y * (1.0f - y);
+            }
+            for (int l = last; l >= 0; l--) {
+                int in = sizes[l];
+                const float* x = (l > 0) ? outputs[l - 1].data() : x0;
+                for (int o = 0; o < sizes[l + 1]; o++) {
+                    for (int i = 0; i < in; i++) gw[l][o * in + i] += errors[l][o] * x[i];
+                    gb[l][o] += errors[l][o];
+                }
+                if (l > 0) {
+                    for (int i = 0; i < in; i++) {
+                        float sum = 0.0f;
+                        for (int o = 0; o < sizes[l + 1]; o++) sum += errors[l][o] * weights[l][o * in + i];
+                        errors[l - 1][i] = sum * x[i] * (1.0f - x[i]);
+                    }
+                }
+            }
+        }
+        for (size_t l = 0; l < weights.size(); l++) {
+            for (size_t k = 0; k < weights[l].size(); k++) weights[l][k] -= rate / batch * gw[l][k];
+            for (size_t k = 0; k < biases[l].size(); k++) biases[l][k] -= rate / batch * gb[l][k];
+        }
+    }
+
+    // Largest difference from a DenseNetwork's parameters
+    float MaxDifference(const DenseNetwork& net) const {
+        float worst = 0.0f;
+        for (size_t l = 0; l < weights.size(); l++) {
+            int in = sizes[l];
+            for (int o = 0; o < sizes[l + 1]; o++) {
+                for (int i = 0; i < in; i++) worst = std::max(worst, std::fabs(weights[l][o * in + i] - net.Weight(l, i, o)));
+                worst = std::max(worst, std::fabs(biases[l][o] - net.Bias(l, o)));
+            }
+        }
+        return worst;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    int width = (argc > 1) ? atoi(argv[1]) : 256;
+    int batch = (argc > 2) ? atoi(argv[2]) : 64;
+    int steps = (argc > 3) ? atoi(argv[3]) : 50;
+    const int inputs = 256, outputs = 10;
+    const float rate = 0.5f;
+    std::vector<int> sizes = { inputs, width, width, outputs };
+
+    // Random inputs and one-hot targets for `steps` batches
+    int samples = batch * steps;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> value(0.0f, 1.0f);
+    std::vector<float> x(static_cast<size_t>(samples) * inputs), t(static_cast<size_t>(samples) * outputs, 0.0f);
+    for (float& v : x) v = value(rng);
+    for (int s = 0; s < samples; s++) t[s * outputs + rng() % outputs] = 1.0f;
+
+    printf("network: %d-%d-%d-%d  batch: %d  steps: %d\n", inputs, width, width, outputs, batch, steps);
+
+    bool ok = true;
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_AVX2 }) {
+        DenseNetwork net(sizes, ACTIVATION_SIGMOID, ACTIVATION_SIGMOID, 7);
+        net.SetSimdLevel(level);
+        PerSampleNetwork reference(net);
+        net.TrainBatch(x.data(), inputs, t.data(), outputs, batch, rate);
+        reference.TrainBatch(x.data(), inputs, t.data(), outputs, batch, rate);
+        float difference = reference.MaxDifference(net);
+        printf("%-8s max weight difference after one step: %.2e\n", DenseKernels::Name(net.GetSimdLevel()), difference);
+        if (difference > 1e-4f) ok = false;
+    }
+
+    double baseline = 0.0;
+    {
+        DenseNetwork net(sizes, ACTIVATION_SIGMOID, ACTIVATION_SIGMOID, 7);
+        PerSampleNetwork reference(net);
+        int reps = std::max(1, steps / 10); // It is slow
+        auto start = Clock::now();
+        for (int s = 0; s < reps; s++) reference.TrainBatch(&x[s * batch * inputs], inputs, &t[s * batch * outputs], outputs, batch, rate);
+        baseline = reps * batch / Seconds(start);
+        printf("%-16s %12.0f samples/s\n", "per sample:", baseline);
+    }
+
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_AVX2 }) {
+        DenseNetwork net(sizes, ACTIVATION_SIGMOID, ACTIVATION_SIGMOID, 7);
+        net.SetSimdLevel(level);
+        if (net.GetSimdLevel() != level) continue;
+        float loss = 0.0f;
+        auto start = Clock::now();
+        for (int s = 0; s < steps; s++) loss = net.TrainBatch(&x[s * batch * inputs], inputs, &t[s * batch * outputs], outputs, batch, rate);
+        double throughput = static_cast<double>(samples) / Seconds(start);
+        printf("batched %-8s %12.0f samples/s  %6.1fx  (last loss %.4f)\n", DenseKernels::Name(level),
+               throughput, throughput / baseline, loss);
+    }
+
+    return ok ? 0 : 1;
+}
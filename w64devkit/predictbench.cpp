@@ -0,0 +1,60 @@
+#include "NeuralNetwork.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Inference throughput of Network::predict() called per row against predict_batch(),
+// single-threaded and on a JobSystem.
+// Usage: predictbench [rows] [threads]
+// Runs a seeds-sized network (7-5-3) and a wider one (64-256-10) over random rows; all
+// three paths must agree on every row.
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : 0;
+    JobSystem jobs(threads);
+
+    printf("rows: %d  threads: %d\n", rows, jobs.ThreadCount());
+    bool ok = true;
+    int shapes[2][3] = { { 7, 5, 3 }, { 64, 256, 10 } };
+    for (auto& shape : shapes) {
+        int inputs = shape[0];
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> value(0.0f, 1.0f);
+        std::vector<float> data(static_cast<size_t>(rows) * inputs);
+        for (float& v : data) v = value(rng);
+
+        Network network;
+        network.initialize_network(inputs, shape[1], shape[2], 7);
+        std::vector<int> single(rows), batched(rows), threaded(rows);
+
+        auto start = Clock::now();
+        for (int r = 0; r < rows; r++) single[r] = network.predict(&data[static_cast<size_t>(r) * inputs]);
+        double singleTime = Seconds(start);
+
+        start = Clock::now();
+        network.predict_batch(data.data(), rows, batched.data());
+        double batchTime = Seconds(start);
+
+        network.jobs = &jobs;
+        start = Clock::now();
+        network.predict_batch(data.data(), rows, threaded.data());
+        double threadTime = Seconds(start);
+
+        ok = ok && single == batched && single == threaded;
+        printf("%d-%d-%d\n", shape[0], shape[1], shape[2]);
+        printf("  predict per row:        %8.1f ns/row\n", singleTime * 1e9 / rows);
+        printf("  predict_batch:          %8.1f ns/row  %5.1fx\n", batchTime * 1e9 / rows, singleTime / batchTime);
+        printf("  predict_batch, threads: %8.1f ns/row  %5.1fx\n", threadTime * 1e9 / rows, singleTime / threadTime);
+    }
+    printf("%s\n", ok ? "all paths agree" : "MISMATCH");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+#include "raylib.h"
+#include "ParticleBuffer.h"
+#include "ParticleRenderer.h"
+#include <cstdlib>
+#include <random>
+
+// Frame rate of ParticleRenderer against one DrawCircleV() per particle.
+// Usage: renderbench [particles]
+// The particle buffers are uploaded every frame, as in waterphy.cpp. SPACE switches
+// between the instanced renderer and DrawCircleV().
+
+const int screenWidth = 1280;
+const int screenHeight = 720;
+const float particleRadius = 2.0f;
+
+int main(int argc, char* argv[]) {
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    InitWindow(screenWidth, screenHeight, "Particle renderer benchmark");
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> x(0.0f, screenWidth), y(0.0f, screenHeight);
+    std::uniform_int_distribution<int> shade(100, 255);
+    ParticleBuffer particles;
+    particles.Reserve(count);
+    for (int i = 0; i < count; i++) {
+        unsigned char b = static_cast<unsigned char>(shade(rng));
+        particles.Add({ x(rng), y(rng) }, { 0, 0 }, { 0, static_cast<unsigned char>(b / 2), b, 255 });
+    }
+
+    ParticleRenderer renderer;
+    renderer.Load();
+    bool instanced = renderer.Instanced();
+
+    while (!WindowShouldClose()) {
+        if (IsKeyPressed(KEY_SPACE) && renderer.Instanced()) instanced = !instanced;
+
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+
+        if (instanced) {
+            renderer.Draw(particles, particleRadius);
+        } else {
+            for (int i = 0; i < particles.Count(); i++) DrawCircleV(particles.Position(i), particleRadius, particles.color[i]);
+        }
+
+        DrawRectangle(0, 0, 420, 60, Fade(BLACK, 0.7f));
+        DrawText(TextFormat("%d particles, %s", count, instanced ? "instanced" : "DrawCircleV"), 10, 10, 20, RAYWHITE);
+        DrawText(TextFormat("%d FPS  %.2f ms/frame", GetFPS(), GetFrameTime() * 1000.0f), 10, 35, 20, RAYWHITE);
+
+        EndDrawing();
+    }
+
+    renderer.Unload();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "raylib.h"
+#include "include/raymath.h"
+#include "ParticleBuffer.h"
+#include "ParticleKernels.h"
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Benchmark the per-step integration (gravity, drag, integration, wall clamping) over
+// SoA particle storage with every kernel level, against the array-of-structs raymath
+// loop waterphy.cpp used before.
+// Usage: simdbench [particles] [steps]
+
+using Clock = std::chrono::steady_clock;
+
+struct AosParticle {
+    Vector2 position;
+    Vector2 velocity;
+    Color color;
+};
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int count = (argc > 1) ? atoi(argv[1]) : 200000;
+    int steps = (argc > 2) ? atoi(argv[2]) : 200;
+
+    IntegrateParams ip = {};
+    ip.gravityX = 0.0f; ip.gravityY = 1800.0f;
+    ip.damping = 0.99f;
+    ip.dt = 1.0f / 120.0f;
+    ip.minX = 4.0f; ip.maxX = 3996.0f;
+    ip.minY = 4.0f; ip.maxY = 3996.0f;
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(ip.minX, ip.maxX);
+    std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+    std::vector<AosParticle> aos(count);
+    for (auto& p : aos) p = { { coord(rng), coord(rng) }, { speed(rng), speed(rng) }, BLUE };
+
+    printf("particles: %d  steps: %d  best kernels: %s\n", count, steps, ParticleKernels::Name(ParticleKernels::Detect()));
+
+    // Array of structs through raymath, as in the original UpdateParticles()
+    std::vector<Vector2> next(count);
+    auto start = Clock::now();
+    for (int s = 0; s < steps; s++) {
+        for (int i = 0; i < count; i++) {
+            AosParticle& p = aos[i];
+            p.velocity = Vector2Scale(Vector2Add(p.velocity, { ip.gravityX * ip.dt, ip.gravityY * ip.dt }), ip.damping);
+            next[i] = Vector2Clamp(Vector2Add(p.position, Vector2Scale(p.velocity, ip.dt)), { ip.minX, ip.minY }, { ip.maxX, ip.maxY });
+        }
+        for (int i = 0; i < count; i++) {
+            AosParticle& p = aos[i];
+            p.velocity = Vector2Scale(Vector2Subtract(next[i], p.position), 1.0f / ip.dt);
+            p.position = next[i];
+        }
+    }
+    double baseline = Seconds(start) / steps;
+    printf("%-12s %8.3f ms/step  %6.2f ns/particle\n", "AoS raymath", baseline * 1e3, baseline * 1e9 / count);
+
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        ParticleKernels kernels = ParticleKernels::For(level);
+        if (kernels.level != level) continue; // Not supported here
+
+        ParticleBuffer particles;
+        particles.Reserve(count);
+        for (int i = 0; i < count; i++) particles.Add(aos[i].position, aos[i].velocity, aos[i].color);
+        AlignedArray<float> nextX, nextY;
+        nextX.Reserve(particles.PaddedCount());
+        nextY.Reserve(particles.PaddedCount());
+        int n = (level == SIMD_SCALAR) ? particles.Count() : particles.PaddedCount();
+
+        start = Clock::now();
+        for (int s = 0; s < steps; s++) {
+            kernels.Predict(particles.x.Data(), particles.y.Data(), particles.vx.Data(), particles.vy.Data(),
+                            nextX.Data(), nextY.Data(), n, ip);
+            kernels.Clamp(nextX.Data(), nextY.Data(), n, ip);
+            kernels.UpdateVelocity(particles.x.Data(), particles.y.Data(), nextX.Data(), nextY.Data(),
+                                   particles.vx.Data(), particles.vy.Data(), n, 1.0f / ip.dt);
+        }
+        double elapsed = Seconds(start) / steps;
+        printf("%-12s %8.3f ms/step  %6.2f ns/particle  %5.1fx\n", ParticleKernels::Name(level),
+               elapsed * 1e3, elapsed * 1e9 / count, baseline / elapsed);
+    }
+
+    return 0;
+}